@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+//------------------------------------------------------------------------------
+//
+// Example: Parse a file of URLs
+//
+// Usage: parse_file <path> [threads]
+//
+// Memory-maps a newline-delimited file of
+// URLs, parses every line in parallel without
+// copying, and prints the totals.
+//
+//------------------------------------------------------------------------------
+
+#include <boost/url.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace urls = boost::urls;
+
+// A read-only view of a whole file
+class mapped_file
+{
+    char const* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE map_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+
+public:
+    mapped_file() = default;
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    ~mapped_file()
+    {
+#ifdef _WIN32
+        if(data_)
+            ::UnmapViewOfFile(data_);
+        if(map_)
+            ::CloseHandle(map_);
+        if(file_ != INVALID_HANDLE_VALUE)
+            ::CloseHandle(file_);
+#else
+        if(data_)
+            ::munmap(const_cast<char*>(data_), size_);
+        if(fd_ != -1)
+            ::close(fd_);
+#endif
+    }
+
+    bool
+    open(char const* path)
+    {
+#ifdef _WIN32
+        file_ = ::CreateFileA(path, GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if(file_ == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER n;
+        if(! ::GetFileSizeEx(file_, &n))
+            return false;
+        size_ = static_cast<std::size_t>(n.QuadPart);
+        if(size_ == 0)
+            return true;
+        map_ = ::CreateFileMappingA(file_, nullptr,
+            PAGE_READONLY, 0, 0, nullptr);
+        if(! map_)
+            return false;
+        data_ = static_cast<char const*>(
+            ::MapViewOfFile(map_, FILE_MAP_READ, 0, 0, 0));
+        return data_ != nullptr;
+#else
+        fd_ = ::open(path, O_RDONLY);
+        if(fd_ == -1)
+            return false;
+        struct stat st;
+        if(::fstat(fd_, &st) != 0)
+            return false;
+        size_ = static_cast<std::size_t>(st.st_size);
+        if(size_ == 0)
+            return true;
+        void* p = ::mmap(nullptr, size_,
+            PROT_READ, MAP_PRIVATE, fd_, 0);
+        if(p == MAP_FAILED)
+            return false;
+        data_ = static_cast<char const*>(p);
+        return true;
+#endif
+    }
+
+    urls::string_view
+    text() const noexcept
+    {
+        return urls::string_view(data_, size_);
+    }
+};
+
+int
+main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::cerr <<
+            "Usage: parse_file <path> [threads]\n";
+        return EXIT_FAILURE;
+    }
+    std::size_t threads = 0;
+    if(argc > 2)
+        threads = std::strtoul(
+            argv[2], nullptr, 10);
+
+    mapped_file f;
+    if(! f.open(argv[1]))
+    {
+        std::cerr <<
+            "Can't open " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    auto const t0 =
+        std::chrono::steady_clock::now();
+    auto const r = urls::parse_uri_lines(
+        f.text(), threads);
+    auto const t1 =
+        std::chrono::steady_clock::now();
+
+    // count urls by scheme, to show
+    // the views are usable
+    std::map<std::string, std::size_t> schemes;
+    for(auto const& c : r.chunks)
+        for(auto const& u : c.urls)
+            ++schemes[u.scheme().to_string()];
+
+    std::size_t lines = 0;
+    std::size_t errors = 0;
+    for(std::size_t i = 0; i < r.workers.size(); ++i)
+    {
+        auto const& w = r.workers[i];
+        std::cout <<
+            "thread " << i << ": " <<
+            w.chunks << " chunks, " <<
+            w.lines << " lines, " <<
+            w.errors << " errors\n";
+        lines += w.lines;
+        errors += w.errors;
+    }
+    for(auto const& e : schemes)
+        std::cout << e.first << ": " << e.second << "\n";
+
+    auto const ms = std::chrono::duration_cast<
+        std::chrono::milliseconds>(t1 - t0).count();
+    std::cout <<
+        lines << " lines, " <<
+        errors << " errors, " <<
+        ms << " ms\n";
+    return EXIT_SUCCESS;
+}
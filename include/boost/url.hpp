@@ -10,16 +10,27 @@
 #ifndef BOOST_URL_HPP
 #define BOOST_URL_HPP
 
+#include <boost/url/buffers.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/host_type.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
+#include <boost/url/parse_lines.hpp>
+#include <boost/url/path_index.hpp>
 #include <boost/url/path_view.hpp>
+#include <boost/url/pct_decoded_view.hpp>
+#include <boost/url/query_key_matcher.hpp>
+#include <boost/url/query_params_index.hpp>
 #include <boost/url/query_params_view.hpp>
+#include <boost/url/request_target.hpp>
 #include <boost/url/scheme.hpp>
+#include <boost/url/small_url.hpp>
 #include <boost/url/static_pool.hpp>
+#include <boost/url/static_url.hpp>
 #include <boost/url/string.hpp>
 #include <boost/url/url.hpp>
+#include <boost/url/url_columns.hpp>
+#include <boost/url/url_parser.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/urls.hpp>
 
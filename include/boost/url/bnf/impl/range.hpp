@@ -16,8 +16,110 @@ namespace boost {
 namespace urls {
 namespace bnf {
 
+template<class T, class Grammar>
+class range<T, Grammar>::iterator
+{
+    T v_;
+    char const* next_ = nullptr;
+    char const* end_ = nullptr;
+
+    friend class range;
+
+    explicit
+    iterator(string_view s)
+        : next_(s.data())
+        , end_(s.data() + s.size())
+    {
+        using namespace urls::detail;
+        error_code ec;
+        if(! Grammar::begin(
+            next_, end_, ec, v_))
+        {
+            if(ec == error::end)
+                next_ = nullptr;
+            else if(ec.failed())
+                throw_system_error(ec,
+                    BOOST_CURRENT_LOCATION);
+        }
+    }
+
+    explicit
+    iterator(
+        char const* end) noexcept
+        : end_(end)
+    {
+    }
+
+public:
+    using value_type = T;
+    using pointer = value_type const*;
+    using reference = value_type const&;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    iterator() noexcept = default;
+
+    // The grammar is part of the type,
+    // so only the position is compared
+    bool
+    operator==(
+        iterator const& other) const noexcept
+    {
+        return next_ == other.next_;
+    }
+
+    bool
+    operator!=(
+        iterator const& other) const noexcept
+    {
+        return next_ != other.next_;
+    }
+
+    value_type const&
+    operator*() const noexcept
+    {
+        return v_;
+    }
+
+    value_type const*
+    operator->() const noexcept
+    {
+        return &v_;
+    }
+
+    iterator&
+    operator++()
+    {
+        using namespace urls::detail;
+        error_code ec;
+        if(Grammar::increment(
+            next_, end_, ec, v_))
+            return *this;
+        if(ec == error::end)
+        {
+            next_ = nullptr;
+            return *this;
+        }
+        if(ec.failed())
+            throw_system_error(ec,
+                BOOST_CURRENT_LOCATION);
+        return *this;
+    }
+
+    iterator
+    operator++(int)
+    {
+        auto temp = *this;
+        ++(*this);
+        return temp;
+    }
+};
+
+//------------------------------------------------
+
 template<class T>
-class range<T>::iterator
+class range<T, void>::iterator
 {
     T v_;
     char const* next_ = nullptr;
@@ -64,6 +166,7 @@ public:
     using value_type = T;
     using pointer = value_type const*;
     using reference = value_type const&;
+    using difference_type = std::ptrdiff_t;
     using iterator_category =
         std::forward_iterator_tag;
 
@@ -129,9 +232,28 @@ public:
 
 //------------------------------------------------
 
+template<class T, class Grammar>
+auto
+range<T, Grammar>::
+begin() const ->
+    iterator
+{
+    return iterator(s_);
+}
+
+template<class T, class Grammar>
+auto
+range<T, Grammar>::
+end() const noexcept ->
+    iterator
+{
+    return iterator(
+        s_.data() + s_.size());
+}
+
 template<class T>
 auto
-range<T>::
+range<T, void>::
 begin() const ->
     iterator
 {
@@ -141,7 +263,7 @@ begin() const ->
 
 template<class T>
 auto
-range<T>::
+range<T, void>::
 end() const ->
     iterator
 {
@@ -150,27 +272,24 @@ end() const ->
         begin_, increment_);
 }
 
-template<class T, class U>
+template<class T, class Grammar>
 bool
 parse_range(
     char const*& it,
     char const* const end,
     error_code& ec,
-    range<T>& t,
-    U const&)
+    range<T, Grammar>& t)
 {
     T v;
     auto start = it;
     std::size_t n = 0;
-    if(! U::begin(it, end, ec, v))
+    if(! Grammar::begin(it, end, ec, v))
     {
         if(ec == error::end)
         {
-            t = range<T>(
+            t = range<T, Grammar>(
                 string_view(start,
-                    it - start), n,
-                &U::begin,
-                &U::increment);
+                    it - start), n);
             ec = {};
             return true;
         }
@@ -183,7 +302,7 @@ parse_range(
     for(;;)
     {
         ++n;
-        if(! U::increment(
+        if(! Grammar::increment(
             it, end, ec, v))
         {
             if(ec == error::end)
@@ -195,15 +314,32 @@ parse_range(
             }
         }
     }
-    t = range<T>(
+    t = range<T, Grammar>(
         string_view(start,
-            it - start), n,
-        &U::begin,
-        &U::increment);
+            it - start), n);
     ec = {};
     return true;
 }
 
+template<class T, class Grammar>
+bool
+parse_range(
+    char const*& it,
+    char const* const end,
+    error_code& ec,
+    range<T>& t,
+    Grammar const&)
+{
+    range<T, Grammar> r;
+    if(! parse_range(it, end, ec, r))
+    {
+        t = {};
+        return false;
+    }
+    t = r;
+    return true;
+}
+
 } // bnf
 } // urls
 } // boost
@@ -23,33 +23,70 @@ namespace boost {
 namespace urls {
 namespace bnf {
 
-template<class T>
+/** A forward range of elements parsed on demand
+
+    A range refers to a string which matched a
+    list grammar, and parses its elements as it
+    is iterated. The grammar provides two static
+    functions, `begin` and `increment`, which
+    parse the first element and each element
+    after it.
+
+    When `Grammar` is given, the iterator calls
+    those functions directly, so they can be
+    inlined into the loop which visits the
+    elements. A range parses itself, as in
+    `bnf::parse( s, ec, r )`.
+
+    The specialization `range<T>`, where the
+    grammar is `void`, holds the functions as
+    pointers instead. It is the type used in
+    aggregates such as @ref uri_bnf where one
+    member may be produced by several grammars,
+    and any `range<T, Grammar>` converts to it.
+
+    @par Example
+    @code
+    bnf::range< pct_encoded_str,
+        detail::path_abempty_bnf > r;
+    if( bnf::parse( "/a/b/c", ec, r ) )
+        for( auto const& t : r )
+            ...
+    @endcode
+*/
+template<
+    class T,
+    class Grammar = void>
 class range
 {
-    using func_ptr = bool(*)(
-        char const*&, char const*,
-            error_code&, T&);
-
     string_view s_;
     std::size_t n_ = 0;
-    func_ptr begin_ = nullptr;
-    func_ptr increment_ = nullptr;
 
     range(
         string_view s,
-        std::size_t n,
-        func_ptr begin,
-        func_ptr increment)
+        std::size_t n) noexcept
         : s_(s)
         , n_(n)
-        , begin_(begin)
-        , increment_(increment)
     {
     }
 
+    template<
+        class T_, class U_>
+    friend
+    bool
+    parse_range(
+        char const*& it,
+        char const* end,
+        error_code& ec,
+        range<T_, U_>& t);
+
 public:
+    /// The type of element
     using value_type = T;
 
+    /// The grammar used to parse elements
+    using grammar_type = Grammar;
+
     class iterator;
 
     range(range const&) = default;
@@ -91,20 +128,139 @@ public:
     begin() const;
 
     iterator
-    end() const;
+    end() const noexcept;
 
-    template<
-        class T_, class U_>
+    /** Parse a range
+    */
     friend
     bool
-    parse_range(
+    parse(
         char const*& it,
         char const* end,
         error_code& ec,
-        range<T_>& t,
-        U_ const&);
+        range& t)
+    {
+        return parse_range(
+            it, end, ec, t);
+    }
+};
+
+//------------------------------------------------
+
+/** A forward range of elements parsed on demand
+
+    This specialization calls the grammar
+    through function pointers, so that ranges
+    produced by different grammars have the
+    same type.
+
+    @see range
+*/
+template<class T>
+class range<T, void>
+{
+    using func_ptr = bool(*)(
+        char const*&, char const*,
+            error_code&, T&);
+
+    string_view s_;
+    std::size_t n_ = 0;
+    func_ptr begin_ = nullptr;
+    func_ptr increment_ = nullptr;
+
+public:
+    using value_type = T;
+
+    class iterator;
+
+    range(range const&) = default;
+    range& operator=(
+        range const&) = default;
+
+    /** Default constructor
+
+        Iteration of default constructed ranges
+        is undefined.
+    */
+    range() = default;
+
+    /** Constructor
+
+        The range refers to the same string
+        and elements as `r`.
+    */
+    template<class Grammar>
+    range(
+        range<T, Grammar> const& r) noexcept
+        : s_(r.str())
+        , n_(r.size())
+        , begin_(&Grammar::begin)
+        , increment_(&Grammar::increment)
+    {
+    }
+
+    /** Return true if the range is empty
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return the number of elements in the range
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return the entire string underlying the range
+    */
+    string_view
+    str() const noexcept
+    {
+        return s_;
+    }
+
+    iterator
+    begin() const;
+
+    iterator
+    end() const;
 };
 
+/** Parse a range of elements using a grammar
+
+    On success, `t` refers to the characters
+    which were consumed and holds the number
+    of elements parsed.
+*/
+template<class T, class Grammar>
+bool
+parse_range(
+    char const*& it,
+    char const* end,
+    error_code& ec,
+    range<T, Grammar>& t);
+
+/** Parse a range of elements using a grammar
+
+    This overload produces a range which calls
+    the grammar through function pointers. The
+    grammar object itself is not used.
+
+    @see range
+*/
+template<class T, class Grammar>
+bool
+parse_range(
+    char const*& it,
+    char const* end,
+    error_code& ec,
+    range<T>& t,
+    Grammar const& g);
+
 } // bnf
 } // urls
 } // boost
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_BUFFERS_HPP
+#define BOOST_URL_BUFFERS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/query_params_view.hpp>
+#include <boost/url/static_pool.hpp>
+#include <boost/url/url_view.hpp>
+
+namespace boost {
+namespace urls {
+
+/*  The functions in this file accept a
+    sequence of buffers holding the input
+    in order. The sequence is a ForwardRange
+    whose elements have `data()` and `size()`
+    members, such as `std::vector<string_view>`
+    or an array of `asio::const_buffer`.
+
+    The input is parsed one buffer at a time
+    without copying. When the buffers turn out
+    to be adjacent in memory, the result refers
+    to them directly. Otherwise the characters
+    are copied once, after parsing succeeds,
+    into storage obtained from the caller's
+    pool, and the result refers to that.
+*/
+
+/** Parse a URI from a sequence of buffers
+
+    @par BNF
+    @code
+    URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param buffers The buffers holding the input.
+
+    @param pool The storage to use when the
+    buffers are not adjacent. It must be large
+    enough to hold the entire input, and must
+    outlive the returned view.
+
+    @param ec Set to the error, if any.
+
+    @see parse_uri
+*/
+template<class ConstBufferSequence>
+url_view
+parse_uri(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec);
+
+/** Parse a relative-ref from a sequence of buffers
+
+    @par BNF
+    @code
+    relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param buffers The buffers holding the input.
+
+    @param pool The storage to use when the
+    buffers are not adjacent. It must be large
+    enough to hold the entire input, and must
+    outlive the returned view.
+
+    @param ec Set to the error, if any.
+
+    @see parse_relative_ref
+*/
+template<class ConstBufferSequence>
+url_view
+parse_relative_ref(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec);
+
+/** Parse query params from a sequence of buffers
+
+    The query string should not include a
+    leading question mark ('?').
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param buffers The buffers holding the input.
+
+    @param pool The storage to use when the
+    buffers are not adjacent. It must be large
+    enough to hold the entire input, and must
+    outlive the returned view.
+
+    @param ec Set to the error, if any.
+
+    @see parse_query_params
+*/
+template<class ConstBufferSequence>
+query_params_view
+parse_query_params(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec);
+
+} // urls
+} // boost
+
+#include <boost/url/impl/buffers.hpp>
+
+#endif
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_BUFFERS_HPP
+#define BOOST_URL_DETAIL_BUFFERS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/query_params_view.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url_parser.hpp>
+#include <boost/url/url_view.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Parses the buffers of a sequence one at
+// a time, noting whether they turn out to
+// be adjacent in memory.
+class buffers_parser
+{
+    url_parser pr_;
+    char const* first_ = nullptr;
+    char const* last_ = nullptr;
+    std::size_t size_ = 0;
+    bool query_ = false;
+    bool contiguous_ = true;
+
+public:
+    // parse a URI or relative-ref
+    BOOST_URL_DECL
+    explicit
+    buffers_parser(
+        url_parser::grammar g) noexcept;
+
+    // parse a query, without the '?'
+    BOOST_URL_DECL
+    buffers_parser() noexcept;
+
+    BOOST_URL_DECL
+    bool
+    write(
+        string_view s,
+        error_code& ec) noexcept;
+
+    BOOST_URL_DECL
+    bool
+    finish(error_code& ec) noexcept;
+
+    // true if the input was one
+    // run of adjacent characters
+    bool
+    contiguous() const noexcept
+    {
+        return contiguous_;
+    }
+
+    // the input, if contiguous
+    char const*
+    data() const noexcept
+    {
+        return first_ ? first_ : "";
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    // the result, given a pointer
+    // to contiguous input
+    BOOST_URL_DECL
+    url_view
+    url(char const* s) const noexcept;
+
+    BOOST_URL_DECL
+    query_params_view
+    params(char const* s) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
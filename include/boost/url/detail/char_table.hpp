@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_CHAR_TABLE_HPP
+#define BOOST_URL_DETAIL_CHAR_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/simd.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// bits [base, base+64) of the set
+template<class CharSet>
+constexpr
+std::uint64_t
+make_char_word(
+    unsigned base,
+    unsigned i = 0) noexcept
+{
+    return i == 64 ? 0 : (
+        (CharSet{}(static_cast<char>(base + i)) ?
+            (std::uint64_t(1) << i) : 0) |
+        make_char_word<CharSet>(base, i + 1));
+}
+
+// nibble lookup entry for low nibble n
+template<class CharSet>
+constexpr
+unsigned char
+make_char_nibble(
+    unsigned n,
+    unsigned h = 0) noexcept
+{
+    return h == 8 ? 0 : static_cast<
+        unsigned char>(
+        (CharSet{}(static_cast<char>((h << 4) | n)) ?
+            (1u << h) : 0) |
+        make_char_nibble<CharSet>(n, h + 1));
+}
+
+/*  Compile-time membership table for a set of
+    7-bit characters, generated from a constexpr
+    character predicate. Membership tests are a
+    shift and mask against immediate values.
+*/
+template<class CharSet>
+struct char_table
+{
+    static constexpr std::uint64_t lo =
+        make_char_word<CharSet>(0);
+
+    static constexpr std::uint64_t hi =
+        make_char_word<CharSet>(64);
+
+    static constexpr nibble_set nibbles = {{
+        make_char_nibble<CharSet>( 0), make_char_nibble<CharSet>( 1),
+        make_char_nibble<CharSet>( 2), make_char_nibble<CharSet>( 3),
+        make_char_nibble<CharSet>( 4), make_char_nibble<CharSet>( 5),
+        make_char_nibble<CharSet>( 6), make_char_nibble<CharSet>( 7),
+        make_char_nibble<CharSet>( 8), make_char_nibble<CharSet>( 9),
+        make_char_nibble<CharSet>(10), make_char_nibble<CharSet>(11),
+        make_char_nibble<CharSet>(12), make_char_nibble<CharSet>(13),
+        make_char_nibble<CharSet>(14), make_char_nibble<CharSet>(15) }};
+
+    // characters above 0x7f must not be in the set
+    BOOST_STATIC_ASSERT(
+        make_char_word<CharSet>(128) == 0 &&
+        make_char_word<CharSet>(192) == 0);
+
+    static
+    constexpr
+    bool
+    contains(char c) noexcept
+    {
+        return static_cast<unsigned char>(c) < 128 &&
+            (((static_cast<unsigned char>(c) < 64 ?
+                lo : hi) >> (static_cast<
+                    unsigned char>(c) & 63)) & 1) != 0;
+    }
+};
+
+template<class CharSet>
+constexpr std::uint64_t char_table<CharSet>::lo;
+
+template<class CharSet>
+constexpr std::uint64_t char_table<CharSet>::hi;
+
+template<class CharSet>
+constexpr nibble_set char_table<CharSet>::nibbles;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -14,6 +14,9 @@
 #include <boost/url/error.hpp>
 #include <boost/url/string.hpp>
 #include <boost/url/bnf/char_set.hpp>
+#include <boost/url/detail/char_table.hpp>
+#include <boost/url/detail/simd.hpp>
+#include <boost/url/rfc/char_sets.hpp>
 #include <cstdint>
 
 namespace boost {
@@ -50,66 +53,66 @@ is_alpha(
     return false;
 }
 
+// [A-Za-z.+-]
+struct scheme_chars
+{
+    constexpr
+    bool
+    operator()(char c) const noexcept
+    {
+        return
+            bnf::alpha_chars{}(c) ||
+            c == '+' || c == '-' || c == '.';
+    }
+};
+
 inline
 bool
 is_scheme_char(
     char c) noexcept
 {
-    // [A-Za-z.+-]
-    static constexpr char tab[] =
-        "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" //   0...31
-        "\0\0\0\0\0\0\0\0\0\0\0\1\0\1\1\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" //  32...63
-        "\0\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\0\0\0\0\0" //  64...95
-        "\0\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\0\0\0\0\0" //  96..127
-        "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" // 128..159
-        "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" // 160..191
-        "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" // 192..223
-        "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0" // 224..255
-        ;
-    return tab[static_cast<unsigned char>(c)] != 0;
+    return char_table<
+        scheme_chars>::contains(c);
 }
 
 //----------------------------------------------------------
 
 class pct_encoding
 {
-    char const* tab_;
+    // characters which do
+    // not need escaping
+    std::uint64_t lo_;
+    std::uint64_t hi_;
+    nibble_set const* ns_;
 
-    char
-    needed(char c) const noexcept
-    {
-        return tab_[static_cast<
-            unsigned char>(c)];
-    }
-
-    void
-    encode(char* dest, char c) const noexcept
+    bool
+    contains(char c) const noexcept
     {
-        static constexpr char hex[] =
-            "0123456789ABCDEF";
-        *dest++ = '%';
         auto const u = static_cast<
             unsigned char>(c);
-        *dest++ = hex[u>>4];
-        *dest = hex[u&0xf];
+        return u < 128 && (((u < 64 ?
+            lo_ : hi_) >> (u & 63)) & 1) != 0;
     }
 
 public:
     pct_encoding(pct_encoding const&) = default;
     pct_encoding& operator=(pct_encoding const&) = default;
 
+    // Characters in CharSet are not escaped
+    template<class CharSet>
     explicit
     pct_encoding(
-        char const* tab) noexcept
-        : tab_(tab)
+        CharSet const&) noexcept
+        : lo_(char_table<CharSet>::lo)
+        , hi_(char_table<CharSet>::hi)
+        , ns_(&char_table<CharSet>::nibbles)
     {
     }
 
-    char
+    bool
     is_special(char c) const noexcept
     {
-        return tab_[static_cast<
-            unsigned char>(c)] == '\3';
+        return ! contains(c);
     }
 
     static
@@ -184,6 +187,20 @@ public:
         char const* const end,
         error_code& ec) const noexcept
     {
+        std::size_t n;
+        return parse(begin, end, ec, n);
+    }
+
+    // Also sets the decoded size
+    // of the characters parsed
+    char const*
+    parse(
+        char const* const begin,
+        char const* const end,
+        error_code& ec,
+        std::size_t& decoded) const noexcept
+    {
+        std::size_t n = 0;
         auto p = begin;
         while(p < end)
         {
@@ -192,14 +209,17 @@ public:
                 check_escape(
                     p + 1, end, ec);
                 if(ec)
-                    return p;
+                    break;
                 p += 3;
+                ++n;
                 continue;
             }
             if(is_special(*p))
                 break;
             ++p;
+            ++n;
         }
+        decoded = n;
         return p;
     }
 
@@ -257,35 +277,24 @@ public:
     encoded_size(
         string_view s) const noexcept
     {
-        std::size_t n = 0;
-        auto p = s.data();
-        auto const p1 = p + s.size();
-        while(p < p1)
-            n += needed(*p++);
-        return n;
+        return simd_pct_encoded_size(
+            s.data(), s.data() + s.size(),
+            *ns_);
     }
 
-    std::size_t
+    // [dest, end) must hold exactly
+    // encoded_size(s) characters
+    void
     encode(
         char* dest,
+        char* end,
         string_view s) const noexcept
     {
-        auto p = s.data();
-        auto const p1 = p + s.size();
-        auto const d0 = dest;
-        while(p < p1)
-        {
-            if(! is_special(*p))
-            {
-                *dest++ = *p++;
-            }
-            else
-            {
-                encode(dest, *p++);
-                dest += 3;
-            }
-        }
-        return dest - d0;
+        auto const p = simd_pct_encode(
+            dest, end, s.data(),
+            s.data() + s.size(), *ns_);
+        BOOST_ASSERT(p == end);
+        (void)p;
     }
 };
 
@@ -296,17 +305,8 @@ pct_encoding
 reg_name_pct_set() noexcept
 {
     // unreserved / subdelims
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\3" "\1\1\1\1\1\1\1\1\1\1\3\1\3\1\3\3" //  32...63
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        unsub_char_mask>{});
 }
 
 inline
@@ -314,17 +314,9 @@ pct_encoding
 userinfo_pct_set() noexcept
 {
     // unreserved / subdelims / ':'
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\3" "\1\1\1\1\1\1\1\1\1\1\1\1\3\1\3\3" //  32...63
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        unsub_char_mask |
+        colon_char_mask>{});
 }
 
 // userinfo_pct_set without ':'
@@ -340,17 +332,18 @@ pct_encoding
 pchar_pct_set() noexcept
 {
     // unreserved / subdelims / ':' / '@'
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\3" "\1\1\1\1\1\1\1\1\1\1\1\1\3\1\3\3" //  32...63
-        "\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        pchar_mask>{});
+}
+
+inline
+pct_encoding
+path_pct_set() noexcept
+{
+    // unreserved / subdelims / ':' / '@' / '/'
+    return pct_encoding(masked_char_set<
+        pchar_mask |
+        slash_char_mask>{});
 }
 
 inline
@@ -358,17 +351,9 @@ pct_encoding
 pchar_nc_pct_set() noexcept
 {
     // unreserved / subdelims / '@'
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\3" "\1\1\1\1\1\1\1\1\1\1\3\1\3\1\3\3" //  32...63
-        "\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        unsub_char_mask |
+        at_char_mask>{});
 }
 
 inline
@@ -376,34 +361,19 @@ pct_encoding
 frag_pct_set() noexcept
 {
     // unreserved / subdelims / ':' / '@' / '/' / '?'
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\1\3\1\3\1" //  32...63
-        "\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        pchar_mask |
+        slash_char_mask |
+        question_char_mask>{});
 }
 inline
 pct_encoding
 qkey_pct_set() noexcept
 {
     // frag_pct_set() minus '='
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1" //  32...63
-        "\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        qpchar_mask |
+        amper_char_mask>{});
 }
 
 inline
@@ -411,17 +381,9 @@ pct_encoding
 qval_pct_set() noexcept
 {
     // frag_pct_set minus '&'
-    static constexpr char tab[] =
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" //   0...31
-        "\3\1\3\3\1\3\3\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\1\3\1\3\1" //  32...63
-        "\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\3\1" //  64...95
-        "\3\1\1\1\1\1\1\1\1\1\1\1\1\1\1\1" "\1\1\1\1\1\1\1\1\1\1\1\3\3\3\1\3" //  96..127
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 128..159
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 160..191
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 192..223
-        "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" "\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3\3" // 224..255
-        ;
-    return pct_encoding(tab);
+    return pct_encoding(masked_char_set<
+        qpchar_mask |
+        equals_char_mask>{});
 }
 
 // DEPRECATED
@@ -34,6 +34,25 @@
 # define BOOST_URL_NODISCARD
 #endif
 
+// Vectorized character scanning on x86,
+// selected at runtime based on the CPU.
+// Define BOOST_URL_NO_SIMD to disable.
+#if ! defined(BOOST_URL_NO_SIMD) && \
+    ( defined(__x86_64__) || defined(_M_X64) || \
+      defined(__i386__) || defined(_M_IX86) ) && \
+    ( defined(__GNUC__) || defined(_MSC_VER) )
+# define BOOST_URL_USE_SIMD
+# if defined(_MSC_VER) && ! defined(__clang__)
+#  define BOOST_URL_TARGET(arch)
+# else
+#  define BOOST_URL_TARGET(arch) __attribute__((target(arch)))
+# endif
+#endif
+
+// BOOST_URL_DFA_PARSER is accepted for
+// compatibility and ignored: parsing always
+// uses the table driven parser in detail/dfa.hpp.
+
 #if defined(BOOST_URL_DOCS)
 # define BOOST_URL_DECL
 #else
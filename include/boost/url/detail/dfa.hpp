@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_DFA_HPP
+#define BOOST_URL_DETAIL_DFA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/detail/parts.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  Single pass, table driven URI parser
+
+    Each input byte is mapped to a character
+    class and run through a table of state
+    transitions. Component boundaries, segment
+    and parameter counts, decoded sizes, the
+    port number and the host address are all
+    accumulated as the bytes go by, so nothing
+    is scanned twice and no intermediate
+    grammar objects are built.
+
+    All state lives in the object, so input
+    may be presented in any number of pieces.
+*/
+class dfa
+{
+public:
+    // The grammar to match
+    enum kind
+    {
+        // URI
+        uri,
+
+        // relative-ref
+        relative_ref,
+
+        // URI-reference
+        uri_reference,
+
+        // absolute-path [ "?" query ]
+        // or a fragment, which the
+        // caller must reject
+        origin_form,
+
+        // host [ ":" port ], followed
+        // by anything a URI allows,
+        // which the caller must reject
+        authority_form
+    };
+
+    BOOST_URL_DECL
+    explicit
+    dfa(kind k) noexcept;
+
+    // Consume input. Returns
+    // false if the input is invalid.
+    BOOST_URL_DECL
+    bool
+    write(
+        char const* data,
+        std::size_t size,
+        error_code& ec) noexcept;
+
+    // Indicate the end of input. Returns
+    // false if the input is invalid.
+    BOOST_URL_DECL
+    bool
+    finish(error_code& ec) noexcept;
+
+    // Return true if the complete input
+    // matches, without recording anything
+    // but what validity depends on.
+    BOOST_URL_DECL
+    bool
+    match(
+        char const* data,
+        std::size_t size) noexcept;
+
+    // The number of characters consumed,
+    // or the position of the error
+    std::size_t
+    pos() const noexcept
+    {
+        return pos_;
+    }
+
+    // The result, after finish
+    parts const&
+    get() const noexcept
+    {
+        return pt_;
+    }
+
+private:
+    struct table;
+
+    static table const& get_table() noexcept;
+
+    bool act(unsigned a, unsigned cls,
+        char c, error_code& ec) noexcept;
+    void set_from(int id, std::size_t pos,
+        std::size_t npct) noexcept;
+    void end_authority(std::size_t pos) noexcept;
+    void feed_v4(char c) noexcept;
+    bool feed_ip(char c) noexcept;
+    bool end_ip() noexcept;
+
+    parts pt_;
+    std::size_t pct_[id_end + 1];
+    std::size_t pos_ = 0;
+    std::size_t npct_ = 0;
+    std::size_t auth_ = 0;
+    std::size_t auth_pct_ = 0;
+    std::size_t colon_ = 0;
+    std::size_t colon_pct_ = 0;
+    std::size_t nslash_ = 0;
+    std::size_t namp_ = 0;
+    std::uint32_t port_ = 0;
+    unsigned char st_;
+    unsigned char st0_ = 0;
+    bool has_auth_ = false;
+    bool has_pass_ = false;
+    bool lead_slash_ = false;
+    bool has_query_ = false;
+    bool has_frag_ = false;
+
+    // IPv4address candidate
+    unsigned char v4_[4];
+    unsigned char v4n_ = 0;
+    unsigned char v4d_ = 0;
+    unsigned short v4v_ = 0;
+    bool v4ok_ = true;
+
+    // IP-literal
+    std::uint16_t w_[8];
+    unsigned char ist_ = 0;
+    unsigned char wn_ = 0;
+    signed char dc_ = -1;
+    unsigned char nd_ = 0;
+    std::uint16_t hex_ = 0;
+};
+
+// Parse a complete string
+BOOST_URL_DECL
+bool
+parse_dfa(
+    string_view s,
+    dfa::kind k,
+    parts& p,
+    error_code& ec) noexcept;
+
+// Match a complete string
+BOOST_URL_DECL
+bool
+match_dfa(
+    string_view s,
+    dfa::kind k) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
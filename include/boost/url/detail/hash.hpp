@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_HASH_HPP
+#define BOOST_URL_DETAIL_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// FNV-1a over a range of characters.
+// Decoded and plain strings with the
+// same characters hash the same.
+template<class Range>
+std::size_t
+hash_chars(Range const& r) noexcept
+{
+    std::uint64_t h =
+        0xcbf29ce484222325ULL;
+    for(char c : r)
+    {
+        h ^= static_cast<
+            unsigned char>(c);
+        h *= 0x100000001b3ULL;
+    }
+    return static_cast<
+        std::size_t>(h);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_BUFFERS_IPP
+#define BOOST_URL_DETAIL_IMPL_BUFFERS_IPP
+
+#include <boost/url/detail/buffers.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+buffers_parser::
+buffers_parser(
+    url_parser::grammar g) noexcept
+    : pr_(g)
+{
+}
+
+buffers_parser::
+buffers_parser() noexcept
+    : pr_(url_parser::relative_ref)
+    , query_(true)
+{
+    // a query is parsed as a relative-ref
+    // consisting only of "?" query
+    error_code ec;
+    pr_.write("?", ec);
+}
+
+bool
+buffers_parser::
+write(
+    string_view s,
+    error_code& ec) noexcept
+{
+    if(s.empty())
+    {
+        ec = {};
+        return true;
+    }
+    if(! first_)
+        first_ = s.data();
+    else if(s.data() != last_)
+        contiguous_ = false;
+    last_ = s.data() + s.size();
+    size_ += s.size();
+    pr_.write(s, ec);
+    return ! ec;
+}
+
+bool
+buffers_parser::
+finish(error_code& ec) noexcept
+{
+    pr_.finish(ec);
+    if(ec)
+        return false;
+    if( query_ &&
+        pr_.parts().length(id_query) !=
+            size_ + 1)
+    {
+        // "#" ends the query
+        ec = error::syntax;
+        return false;
+    }
+    return true;
+}
+
+url_view
+buffers_parser::
+url(char const* s) const noexcept
+{
+    BOOST_ASSERT(! query_);
+    return pr_.result(s);
+}
+
+query_params_view
+buffers_parser::
+params(char const* s) const noexcept
+{
+    BOOST_ASSERT(query_);
+    return query_params_view(
+        string_view(s, size_),
+        pr_.parts().nparam);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,1124 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_DFA_IPP
+#define BOOST_URL_DETAIL_IMPL_DFA_IPP
+
+#include <boost/url/detail/dfa.hpp>
+#include <boost/url/detail/simd.hpp>
+#include <boost/url/bnf/char_set.hpp>
+#include <initializer_list>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct dfa::table
+{
+    // character classes
+    enum
+    {
+        c_inv = 0,  // not allowed anywhere
+        c_alpha,    // ALPHA, except HEXDIG
+        c_hexa,     // "A"-"F" / "a"-"f"
+        c_digit,    // DIGIT
+        c_sch,      // "+" / "-"
+        c_dot,      // "."
+        c_unsub,    // other unreserved / sub-delims
+        c_amp,      // "&"
+        c_colon,    // ":"
+        c_slash,    // "/"
+        c_quest,    // "?"
+        c_hash,     // "#"
+        c_at,       // "@"
+        c_lbr,      // "["
+        c_rbr,      // "]"
+        c_pct,      // "%"
+        c_end,      // end of input
+        n_class
+    };
+
+    // states
+    enum
+    {
+        s_err = 0,
+        s_uri,          // start of URI
+        s_rel,          // start of relative-ref
+        s_ref,          // start of URI-reference
+        s_origin,       // start of origin-form
+        s_scheme,       // scheme
+        s_schseg,       // scheme or first segment
+        s_hier,         // after scheme ":"
+        s_slash1,       // after leading "/"
+        s_auth,         // after "//"
+        s_auth_a,       // userinfo or host, maybe IPv4
+        s_auth_n,       // userinfo or reg-name
+        s_auth_b,       // userinfo or host ":" port
+        s_auth_c,       // userinfo with ':'
+        s_host,         // after "@"
+        s_host_name,    // reg-name or IPv4address
+        s_host_n,       // reg-name
+        s_port,         // port
+        s_iplit,        // inside "[" "]"
+        s_iplit_end,    // after "]"
+        s_seg0,         // segment-nz-nc
+        s_path,         // path
+        s_query,        // query
+        s_frag,         // fragment
+        s_done,         // end of input seen
+
+        // "%" and "%" HEXDIG, a pair for
+        // each state returned to after
+        s_pct,
+        n_pct = 7,
+        n_state = s_pct + 2 * n_pct
+    };
+
+    // transition actions
+    enum
+    {
+        a_none = 0,
+        a_err,
+        a_scheme,       // end of scheme
+        a_slash1,       // leading "/"
+        a_auth,         // "//"
+        a_slash,        // path "/"
+        a_pct,          // "%"
+        a_colon,        // userinfo or port ':'
+        a_port,         // port DIGIT
+        a_at,           // end of userinfo
+        a_v4,           // reg-name or IPv4address
+        a_auth_end,     // end of authority
+        a_query,        // "?"
+        a_amp,          // "&" in query
+        a_frag,         // "#"
+        a_end,          // end of input
+        a_iplit,        // "["
+        a_ip,           // IP-literal
+        a_iplit_end,    // "]"
+        a_host_colon    // port ':'
+    };
+
+    unsigned char cls[256];
+    std::uint16_t next[n_state][n_class];
+
+    // characters which leave each
+    // state unchanged, with no action
+    nibble_set run[n_state];
+
+    table() noexcept;
+
+private:
+    void
+    set(
+        unsigned s,
+        std::initializer_list<unsigned> cs,
+        unsigned to,
+        unsigned a = a_none) noexcept
+    {
+        for(auto c : cs)
+            next[s][c] = static_cast<
+                std::uint16_t>(to | (a << 8));
+    }
+};
+
+dfa::
+table::
+table() noexcept
+{
+    // classify
+    for(unsigned i = 0; i < 256; ++i)
+    {
+        char const c = static_cast<char>(i);
+        unsigned char k = c_inv;
+        if(bnf::hexdig_chars{}(c) &&
+            ! bnf::digit_chars{}(c))
+            k = c_hexa;
+        else if(bnf::alpha_chars{}(c))
+            k = c_alpha;
+        else if(bnf::digit_chars{}(c))
+            k = c_digit;
+        else switch(c)
+        {
+        case '+': case '-':
+            k = c_sch; break;
+        case '.': k = c_dot; break;
+        case '_': case '~': case '!':
+        case '$': case '\'': case '(':
+        case ')': case '*': case ',':
+        case ';': case '=':
+            k = c_unsub; break;
+        case '&': k = c_amp; break;
+        case ':': k = c_colon; break;
+        case '/': k = c_slash; break;
+        case '?': k = c_quest; break;
+        case '#': k = c_hash; break;
+        case '@': k = c_at; break;
+        case '[': k = c_lbr; break;
+        case ']': k = c_rbr; break;
+        case '%': k = c_pct; break;
+        default:
+            break;
+        }
+        cls[i] = k;
+    }
+
+    // everything not listed is an error
+    for(unsigned s = 0; s < n_state; ++s)
+    {
+        for(unsigned c = 0; c < n_class; ++c)
+            next[s][c] = s_err | (a_err << 8);
+    }
+
+    // unreserved / sub-delims
+    std::initializer_list<unsigned> const unsub = {
+        c_alpha, c_hexa, c_digit,
+        c_sch, c_dot, c_unsub, c_amp };
+    std::initializer_list<unsigned> const pchar = {
+        c_alpha, c_hexa, c_digit,
+        c_sch, c_dot, c_unsub, c_amp,
+        c_colon, c_at };
+    std::initializer_list<unsigned> const qchar = {
+        c_alpha, c_hexa, c_digit,
+        c_sch, c_dot, c_unsub, c_colon,
+        c_at, c_slash, c_quest };
+    // reg-name characters which
+    // rule out an IPv4address
+    std::initializer_list<unsigned> const name = {
+        c_alpha, c_hexa, c_sch,
+        c_unsub, c_amp };
+    // pct-encoded, then back to r
+    unsigned const pct_ret[n_pct] = {
+        s_seg0, s_path, s_auth_n, s_auth_c,
+        s_host_n, s_query, s_frag };
+    auto const pct = [this, &pct_ret](
+        unsigned s, unsigned r)
+    {
+        unsigned i = 0;
+        while(pct_ret[i] != r)
+            ++i;
+        set(s, {c_pct}, s_pct + 2 * i, a_pct);
+    };
+    for(unsigned i = 0; i < n_pct; ++i)
+    {
+        set(s_pct + 2 * i, {c_hexa, c_digit},
+            s_pct + 2 * i + 1);
+        set(s_pct + 2 * i + 1, {c_hexa, c_digit},
+            pct_ret[i]);
+    }
+
+    // "?" query, "#" fragment, or end
+    auto const tail = [this](unsigned s)
+    {
+        set(s, {c_quest}, s_query, a_query);
+        set(s, {c_hash}, s_frag, a_frag);
+        set(s, {c_end}, s_done, a_end);
+    };
+
+    // authority ends at "/", "?", "#", or end
+    auto const end_auth = [this](unsigned s)
+    {
+        set(s, {c_slash}, s_path, a_auth_end);
+        set(s, {c_quest}, s_query, a_auth_end);
+        set(s, {c_hash}, s_frag, a_auth_end);
+        set(s, {c_end}, s_done, a_auth_end);
+    };
+
+    // scheme
+    set(s_uri, {c_alpha, c_hexa}, s_scheme);
+    set(s_scheme, {c_alpha, c_hexa,
+        c_digit, c_sch, c_dot}, s_scheme);
+    set(s_scheme, {c_colon}, s_hier, a_scheme);
+
+    // relative-ref, URI-reference
+    for(unsigned s : { s_rel, s_ref })
+    {
+        set(s, unsub, s_seg0);
+        set(s, {c_at}, s_seg0);
+        pct(s, s_seg0);
+        set(s, {c_slash}, s_slash1, a_slash1);
+        tail(s);
+    }
+    set(s_ref, {c_alpha, c_hexa}, s_schseg);
+    set(s_schseg, {c_alpha, c_hexa,
+        c_digit, c_sch, c_dot}, s_schseg);
+    set(s_schseg, {c_colon}, s_hier, a_scheme);
+    set(s_schseg, {c_unsub, c_amp, c_at}, s_seg0);
+    pct(s_schseg, s_seg0);
+    set(s_schseg, {c_slash}, s_path, a_slash);
+    tail(s_schseg);
+
+    // hier-part, relative-part
+    for(unsigned s : { s_hier, s_slash1 })
+    {
+        set(s, pchar, s_path);
+        pct(s, s_path);
+        tail(s);
+    }
+    set(s_hier, {c_slash}, s_slash1, a_slash1);
+    set(s_slash1, {c_slash}, s_auth, a_auth);
+
+    // origin-form, where "//" starts a path
+    set(s_origin, {c_slash}, s_path, a_slash1);
+
+    // authority
+    for(unsigned s : { s_auth, s_auth_a, s_auth_n })
+    {
+        set(s, name, s_auth_n);
+        set(s, {c_digit, c_dot}, s_auth_a, a_v4);
+        set(s, {c_colon}, s_auth_b, a_colon);
+        pct(s, s_auth_n);
+        set(s, {c_at}, s_host, a_at);
+        end_auth(s);
+    }
+    set(s_auth, {c_dot}, s_auth_n);
+    set(s_auth_n, {c_digit, c_dot}, s_auth_n);
+    set(s_auth, {c_lbr}, s_iplit, a_iplit);
+    set(s_auth_b, {c_digit}, s_auth_b, a_port);
+    set(s_auth_b, name, s_auth_c);
+    set(s_auth_b, {c_dot, c_colon}, s_auth_c);
+    pct(s_auth_b, s_auth_c);
+    set(s_auth_b, {c_at}, s_host, a_at);
+    end_auth(s_auth_b);
+    set(s_auth_c, unsub, s_auth_c);
+    set(s_auth_c, {c_colon}, s_auth_c);
+    pct(s_auth_c, s_auth_c);
+    set(s_auth_c, {c_at}, s_host, a_at);
+    for(unsigned s : { s_host, s_host_name, s_host_n })
+    {
+        set(s, name, s_host_n);
+        set(s, {c_digit, c_dot}, s_host_name, a_v4);
+        pct(s, s_host_n);
+        set(s, {c_colon}, s_port, a_host_colon);
+        end_auth(s);
+    }
+    set(s_host, {c_dot}, s_host_n);
+    set(s_host_n, {c_digit, c_dot}, s_host_n);
+    set(s_host, {c_lbr}, s_iplit, a_iplit);
+    set(s_port, {c_digit}, s_port, a_port);
+    end_auth(s_port);
+    set(s_iplit, unsub, s_iplit, a_ip);
+    set(s_iplit, {c_colon}, s_iplit, a_ip);
+    set(s_iplit, {c_rbr}, s_iplit_end, a_iplit_end);
+    set(s_iplit_end, {c_colon}, s_port, a_host_colon);
+    end_auth(s_iplit_end);
+
+    // path
+    set(s_seg0, unsub, s_seg0);
+    set(s_seg0, {c_at}, s_seg0);
+    pct(s_seg0, s_seg0);
+    set(s_seg0, {c_slash}, s_path, a_slash);
+    tail(s_seg0);
+    set(s_path, pchar, s_path);
+    pct(s_path, s_path);
+    set(s_path, {c_slash}, s_path, a_slash);
+    tail(s_path);
+
+    // query
+    set(s_query, qchar, s_query);
+    set(s_query, {c_amp}, s_query, a_amp);
+    pct(s_query, s_query);
+    set(s_query, {c_hash}, s_frag, a_frag);
+    set(s_query, {c_end}, s_done, a_end);
+
+    // fragment
+    set(s_frag, qchar, s_frag);
+    set(s_frag, {c_amp}, s_frag);
+    pct(s_frag, s_frag);
+    set(s_frag, {c_end}, s_done, a_end);
+
+    // runs of characters that can
+    // be skipped without a lookup
+    for(unsigned s = 0; s < n_state; ++s)
+    {
+        for(unsigned i = 0; i < 16; ++i)
+            run[s].lo[i] = 0;
+        for(unsigned i = 0; i < 128; ++i)
+            if(next[s][cls[i]] == s)
+                run[s].lo[i & 0xf] |= static_cast<
+                    unsigned char>(1u << (i >> 4));
+    }
+}
+
+auto
+dfa::
+get_table() noexcept ->
+    table const&
+{
+    static table const t;
+    return t;
+}
+
+//------------------------------------------------
+
+dfa::
+dfa(kind k) noexcept
+{
+    switch(k)
+    {
+    case uri:
+        st_ = table::s_uri;
+        break;
+    case relative_ref:
+        st_ = table::s_rel;
+        break;
+    case origin_form:
+        st_ = table::s_origin;
+        break;
+    case authority_form:
+        // the host starts at once,
+        // with no "//" or userinfo
+        st_ = table::s_host;
+        break;
+    default:
+    case uri_reference:
+        st_ = table::s_ref;
+        break;
+    }
+    for(int i = 0; i <= id_end; ++i)
+        pct_[i] = 0;
+}
+
+bool
+dfa::
+write(
+    char const* const data,
+    std::size_t size,
+    error_code& ec) noexcept
+{
+    auto const& t = get_table();
+    auto const base = pos_;
+    auto const end = data + size;
+    auto p = data;
+    unsigned st = st_;
+    while(p != end)
+    {
+        auto const& r = t.run[st];
+        if(r.contains(*p))
+        {
+            // most runs are short, so
+            // go wide only for long ones
+            auto const q = end - p > 16 ?
+                p + 16 : end;
+            do
+                ++p;
+            while(p != q && r.contains(*p));
+            if(p == q && q != end)
+                p = simd_find_if_not(
+                    p, end, r);
+            if(p == end)
+                break;
+        }
+        auto const c = t.cls[
+            static_cast<unsigned char>(*p)];
+        auto const e = t.next[st][c];
+        if(e < 256)
+        {
+            // no action
+            st = e;
+            ++p;
+            continue;
+        }
+        // the frequent actions are
+        // done here, without a call
+        switch(e >> 8)
+        {
+        case table::a_slash:
+            ++nslash_;
+            st = e & 0xff;
+            ++p;
+            continue;
+
+        case table::a_amp:
+            ++namp_;
+            st = e & 0xff;
+            ++p;
+            continue;
+
+        case table::a_pct:
+            ++npct_;
+            st = e & 0xff;
+            ++p;
+            continue;
+
+        case table::a_port:
+            if(port_ <= 65535)
+                port_ = 10 * port_ + (*p - '0');
+            st = e & 0xff;
+            ++p;
+            continue;
+
+        case table::a_v4:
+            feed_v4(*p);
+            st = e & 0xff;
+            if(! v4ok_)
+                st = st == table::s_auth_a ?
+                    table::s_auth_n :
+                    table::s_host_n;
+            ++p;
+            continue;
+
+        default:
+            break;
+        }
+        st0_ = static_cast<
+            unsigned char>(st);
+        st_ = static_cast<
+            unsigned char>(e & 0xff);
+        pos_ = base + (p - data);
+        if(! act(e >> 8, c, *p, ec))
+            return false;
+        st = st_;
+        ++p;
+    }
+    st_ = static_cast<unsigned char>(st);
+    pos_ = base + size;
+    return true;
+}
+
+bool
+dfa::
+finish(error_code& ec) noexcept
+{
+    auto const& t = get_table();
+    auto const e = t.next[st_][table::c_end];
+    st0_ = st_;
+    st_ = static_cast<
+        unsigned char>(e & 0xff);
+    return act(e >> 8,
+        table::c_end, 0, ec);
+}
+
+//------------------------------------------------
+
+void
+dfa::
+set_from(
+    int id,
+    std::size_t pos,
+    std::size_t npct) noexcept
+{
+    for(int i = id; i <= id_end; ++i)
+    {
+        pt_.offset[i] = pos;
+        pct_[i] = npct;
+    }
+}
+
+void
+dfa::
+feed_v4(char c) noexcept
+{
+    if(! v4ok_)
+        return;
+    if(bnf::digit_chars{}(c))
+    {
+        if( v4d_ == 3 || (
+            v4d_ > 0 && v4v_ == 0))
+        {
+            // too long, or leading '0'
+            v4ok_ = false;
+            return;
+        }
+        v4v_ = static_cast<unsigned short>(
+            10 * v4v_ + (c - '0'));
+        if(v4v_ > 255)
+        {
+            v4ok_ = false;
+            return;
+        }
+        ++v4d_;
+        return;
+    }
+    if( c != '.' ||
+        v4d_ == 0 ||
+        v4n_ == 3)
+    {
+        v4ok_ = false;
+        return;
+    }
+    v4_[v4n_++] = static_cast<
+        unsigned char>(v4v_);
+    v4v_ = 0;
+    v4d_ = 0;
+}
+
+// IP-literal states
+enum
+{
+    ip_start = 0,
+    ip_lead_colon,  // ":"
+    ip_group,       // h16
+    ip_colon,       // h16 ":"
+    ip_dcolon,      // "::"
+    ip_v4,          // IPv4address
+    ip_fut_v,       // "v"
+    ip_fut_hex,     // "v" 1*HEXDIG
+    ip_fut_dot,     // "v" 1*HEXDIG "."
+    ip_fut_tail,    // IPvFuture
+    ip_done_v6,
+    ip_done_fut
+};
+
+bool
+dfa::
+feed_ip(char c) noexcept
+{
+    auto const d = bnf::hexdig_value(c);
+    auto const group = [this, c, d]
+    {
+        // start an h16
+        hex_ = static_cast<
+            std::uint16_t>(d);
+        nd_ = 1;
+        v4ok_ = true;
+        v4n_ = 0;
+        v4d_ = 0;
+        v4v_ = 0;
+        feed_v4(c);
+        ist_ = ip_group;
+    };
+    switch(ist_)
+    {
+    case ip_start:
+        if(c == ':')
+        {
+            ist_ = ip_lead_colon;
+            return true;
+        }
+        if(c == 'v' || c == 'V')
+        {
+            ist_ = ip_fut_v;
+            return true;
+        }
+        if(d == -1)
+            return false;
+        group();
+        return true;
+
+    case ip_lead_colon:
+        if(c != ':')
+            return false;
+        dc_ = 0;
+        ist_ = ip_dcolon;
+        return true;
+
+    case ip_group:
+        if(d != -1)
+        {
+            if(nd_ == 4)
+                return false;
+            hex_ = static_cast<
+                std::uint16_t>(16 * hex_ + d);
+            ++nd_;
+            feed_v4(c);
+            return true;
+        }
+        if(c == ':')
+        {
+            w_[wn_++] = hex_;
+            if(wn_ == 8)
+                return false;
+            ist_ = ip_colon;
+            return true;
+        }
+        if(c == '.')
+        {
+            // ls32 as IPv4address
+            if(wn_ > 6)
+                return false;
+            feed_v4(c);
+            if(! v4ok_)
+                return false;
+            ist_ = ip_v4;
+            return true;
+        }
+        return false;
+
+    case ip_colon:
+        if(c == ':')
+        {
+            if(dc_ != -1)
+                return false;
+            dc_ = static_cast<
+                signed char>(wn_);
+            ist_ = ip_dcolon;
+            return true;
+        }
+        BOOST_FALLTHROUGH;
+
+    case ip_dcolon:
+        if(d == -1)
+            return false;
+        group();
+        return true;
+
+    case ip_v4:
+        feed_v4(c);
+        return v4ok_;
+
+    case ip_fut_v:
+        if(d == -1)
+            return false;
+        ist_ = ip_fut_hex;
+        return true;
+
+    case ip_fut_hex:
+        if(c == '.')
+        {
+            ist_ = ip_fut_dot;
+            return true;
+        }
+        return d != -1;
+
+    case ip_fut_dot:
+    case ip_fut_tail:
+        // the character class
+        // was checked by the table
+        ist_ = ip_fut_tail;
+        return true;
+
+    default:
+        break;
+    }
+    return false;
+}
+
+bool
+dfa::
+end_ip() noexcept
+{
+    switch(ist_)
+    {
+    case ip_group:
+        w_[wn_++] = hex_;
+        break;
+
+    case ip_dcolon:
+        break;
+
+    case ip_v4:
+        if( ! v4ok_ ||
+            v4n_ != 3 ||
+            v4d_ == 0)
+            return false;
+        w_[wn_++] = static_cast<
+            std::uint16_t>(
+                256 * v4_[0] + v4_[1]);
+        w_[wn_++] = static_cast<
+            std::uint16_t>(
+                256 * v4_[2] + v4v_);
+        break;
+
+    case ip_fut_tail:
+        ist_ = ip_done_fut;
+        return true;
+
+    default:
+        return false;
+    }
+    if(dc_ == -1)
+    {
+        if(wn_ != 8)
+            return false;
+    }
+    else if(wn_ > 7)
+    {
+        // "::" is at least one word
+        return false;
+    }
+    // words after "::" go at the end
+    int const n1 = dc_ == -1 ? 0 : wn_ - dc_;
+    int const n0 = wn_ - n1;
+    auto const put = [this](
+        int i, std::uint16_t w)
+    {
+        pt_.ip_addr[2 * i] =
+            static_cast<unsigned char>(w >> 8);
+        pt_.ip_addr[2 * i + 1] =
+            static_cast<unsigned char>(w & 0xff);
+    };
+    for(int i = 0; i < 8; ++i)
+        put(i, 0);
+    for(int i = 0; i < n0; ++i)
+        put(i, w_[i]);
+    for(int i = 0; i < n1; ++i)
+        put(8 - n1 + i, w_[n0 + i]);
+    ist_ = ip_done_v6;
+    return true;
+}
+
+void
+dfa::
+end_authority(
+    std::size_t pos) noexcept
+{
+    switch(st0_)
+    {
+    case table::s_auth:
+    case table::s_auth_a:
+    case table::s_auth_n:
+        // no userinfo, no port
+        set_from(id_pass,
+            auth_ + 2, auth_pct_);
+        set_from(id_port, pos, npct_);
+        break;
+
+    case table::s_auth_b:
+        // host ":" port
+        set_from(id_pass,
+            auth_ + 2, auth_pct_);
+        set_from(id_port,
+            colon_, colon_pct_);
+        break;
+
+    case table::s_host:
+    case table::s_host_name:
+    case table::s_host_n:
+    case table::s_iplit_end:
+        set_from(id_port, pos, npct_);
+        break;
+
+    default:
+    case table::s_port:
+        break;
+    }
+    set_from(id_path, pos, npct_);
+
+    // host
+    if(ist_ == ip_done_v6)
+    {
+        pt_.host_type =
+            urls::host_type::ipv6;
+    }
+    else if(ist_ == ip_done_fut)
+    {
+        pt_.host_type =
+            urls::host_type::ipvfuture;
+    }
+    else if(
+        v4ok_ &&
+        v4n_ == 3 &&
+        v4d_ > 0 &&
+        pt_.offset[id_port] -
+            pt_.offset[id_host] < 16)
+    {
+        pt_.host_type =
+            urls::host_type::ipv4;
+        pt_.ip_addr[0] = v4_[0];
+        pt_.ip_addr[1] = v4_[1];
+        pt_.ip_addr[2] = v4_[2];
+        pt_.ip_addr[3] = static_cast<
+            unsigned char>(v4v_);
+    }
+    else
+    {
+        pt_.host_type =
+            urls::host_type::name;
+    }
+
+    // port
+    if( pt_.offset[id_path] -
+            pt_.offset[id_port] > 1 &&
+        port_ <= 65535)
+        pt_.port_number = static_cast<
+            std::uint16_t>(port_);
+}
+
+bool
+dfa::
+act(
+    unsigned a,
+    unsigned cls,
+    char c,
+    error_code& ec) noexcept
+{
+    // position of c
+    std::size_t const pos = pos_;
+
+    // reg-name characters seen
+    if( st0_ == table::s_auth_n ||
+        st0_ == table::s_host_n)
+        v4ok_ = false;
+
+    switch(a)
+    {
+    default:
+    case table::a_err:
+        if(st0_ >= table::s_pct)
+        {
+            if(cls == table::c_end)
+                ec = error::incomplete_pct_encoding;
+            else
+                ec = error::bad_pct_encoding_digit;
+        }
+        else
+        {
+            ec = error::syntax;
+        }
+        st_ = table::s_err;
+        return false;
+
+    case table::a_scheme:
+        set_from(id_user, pos + 1, npct_);
+        break;
+
+    case table::a_slash1:
+        nslash_ = 1;
+        lead_slash_ = true;
+        break;
+
+    case table::a_auth:
+        has_auth_ = true;
+        auth_ = pos - 1;
+        auth_pct_ = npct_;
+        nslash_ = 0;
+        lead_slash_ = false;
+        set_from(id_user, auth_, npct_);
+        break;
+
+    case table::a_colon:
+        colon_ = pos;
+        colon_pct_ = npct_;
+        port_ = 0;
+        break;
+
+    case table::a_at:
+        has_pass_ =
+            st0_ == table::s_auth_b ||
+            st0_ == table::s_auth_c;
+        if(has_pass_)
+            set_from(id_pass,
+                colon_, colon_pct_);
+        else
+            set_from(id_pass, pos, npct_);
+        set_from(id_host, pos + 1, npct_);
+        v4ok_ = true;
+        v4n_ = 0;
+        v4d_ = 0;
+        v4v_ = 0;
+        break;
+
+    case table::a_auth_end:
+        end_authority(pos);
+        switch(cls)
+        {
+        case table::c_slash:
+            nslash_ = 1;
+            lead_slash_ = true;
+            break;
+        case table::c_quest:
+            return act(table::a_query,
+                cls, c, ec);
+        case table::c_hash:
+            return act(table::a_frag,
+                cls, c, ec);
+        default:
+            return act(table::a_end,
+                cls, c, ec);
+        }
+        break;
+
+    case table::a_query:
+        has_query_ = true;
+        namp_ = 0;
+        set_from(id_query, pos, npct_);
+        break;
+
+    case table::a_frag:
+        // an empty query, if none
+        set_from(has_query_ ?
+            id_frag : id_query, pos, npct_);
+        has_frag_ = true;
+        break;
+
+    case table::a_end:
+    {
+        // close the last component
+        set_from(
+            has_frag_ ? id_end : (
+            has_query_ ? id_frag :
+                id_query), pos, npct_);
+        auto const& o = pt_.offset;
+        auto const len = [&o](int id)
+        {
+            return o[id + 1] - o[id];
+        };
+        auto const esc = [this](int id)
+        {
+            return 2 * (
+                pct_[id + 1] - pct_[id]);
+        };
+        auto& d = pt_.decoded;
+        d[id_scheme] = len(id_scheme) > 0 ?
+            len(id_scheme) - 1 : 0;
+        d[id_user] = has_auth_ ?
+            len(id_user) - 2 - esc(id_user) : 0;
+        d[id_pass] = len(id_pass) > 0 ?
+            len(id_pass) - 1 - has_pass_ -
+                esc(id_pass) : 0;
+        d[id_host] = len(id_host) - esc(id_host);
+        d[id_port] = len(id_port) > 0 ?
+            len(id_port) - 1 : 0;
+        d[id_path] = len(id_path) - esc(id_path);
+        d[id_query] = has_query_ ?
+            len(id_query) - 1 - esc(id_query) : 0;
+        d[id_frag] = has_frag_ ?
+            len(id_frag) - 1 - esc(id_frag) : 0;
+        pt_.nseg = nslash_ + (
+            len(id_path) > 0 && ! lead_slash_);
+        pt_.nparam = has_query_ ? namp_ + 1 : 0;
+        break;
+    }
+
+    case table::a_iplit:
+        if(st0_ == table::s_auth)
+        {
+            set_from(id_pass, pos, npct_);
+            set_from(id_host, pos, npct_);
+        }
+        ist_ = ip_start;
+        wn_ = 0;
+        dc_ = -1;
+        break;
+
+    case table::a_ip:
+        if(! feed_ip(c))
+        {
+            ec = error::syntax;
+            st_ = table::s_err;
+            return false;
+        }
+        break;
+
+    case table::a_iplit_end:
+        if(! end_ip())
+        {
+            ec = error::syntax;
+            st_ = table::s_err;
+            return false;
+        }
+        break;
+
+    case table::a_host_colon:
+        set_from(id_port, pos, npct_);
+        port_ = 0;
+        break;
+    }
+    return true;
+}
+
+bool
+dfa::
+match(
+    char const* const data,
+    std::size_t size) noexcept
+{
+    // Like write and finish, but only the
+    // IP-literal needs more than the state
+    // to decide validity, so every other
+    // action is skipped.
+    auto const& t = get_table();
+    auto const end = data + size;
+    auto p = data;
+    unsigned st = st_;
+    for(;;)
+    {
+        if(p != end)
+        {
+            auto const& r = t.run[st];
+            if(r.contains(*p))
+            {
+                auto const q = end - p > 16 ?
+                    p + 16 : end;
+                do
+                    ++p;
+                while(p != q && r.contains(*p));
+                if(p == q && q != end)
+                    p = simd_find_if_not(
+                        p, end, r);
+            }
+        }
+        unsigned c;
+        char ch = 0;
+        if(p != end)
+        {
+            ch = *p;
+            c = t.cls[static_cast<
+                unsigned char>(ch)];
+        }
+        else
+        {
+            c = table::c_end;
+        }
+        auto const e = t.next[st][c];
+        st = e & 0xff;
+        switch(e >> 8)
+        {
+        case table::a_err:
+            return false;
+
+        case table::a_iplit:
+            ist_ = ip_start;
+            wn_ = 0;
+            dc_ = -1;
+            break;
+
+        case table::a_ip:
+            if(! feed_ip(ch))
+                return false;
+            break;
+
+        case table::a_iplit_end:
+            if(! end_ip())
+                return false;
+            break;
+
+        default:
+            break;
+        }
+        if(p == end)
+            return true;
+        ++p;
+    }
+}
+
+//------------------------------------------------
+
+bool
+parse_dfa(
+    string_view s,
+    dfa::kind k,
+    parts& p,
+    error_code& ec) noexcept
+{
+    dfa d(k);
+    if( ! d.write(s.data(), s.size(), ec) ||
+        ! d.finish(ec))
+        return false;
+    p = d.get();
+    ec = {};
+    return true;
+}
+
+bool
+match_dfa(
+    string_view s,
+    dfa::kind k) noexcept
+{
+    dfa d(k);
+    return d.match(
+        s.data(), s.size());
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -11,7 +11,9 @@
 #define BOOST_URL_DETAIL_IMPL_PARSE_IPP
 
 #include <boost/url/detail/parse.hpp>
+#include <boost/url/detail/dfa.hpp>
 #include <boost/optional.hpp>
+#include <algorithm>
 
 namespace boost {
 namespace urls {
@@ -167,6 +169,228 @@ apply_fragment(
     }
 }
 
+//------------------------------------------------
+
+// Parse s0, s1, and s2 as one string
+static
+bool
+parse_pieces(
+    parts& pt,
+    dfa::kind k,
+    string_view s0,
+    string_view s1,
+    string_view s2 = {}) noexcept
+{
+    error_code ec;
+    dfa d(k);
+    if( ! d.write(s0.data(), s0.size(), ec) ||
+        ! d.write(s1.data(), s1.size(), ec) ||
+        ! d.write(s2.data(), s2.size(), ec) ||
+        ! d.finish(ec))
+        return false;
+    pt = d.get();
+    return true;
+}
+
+void
+parse_url(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    if(! parse_dfa(s,
+            dfa::uri_reference, pt, ec))
+        return;
+    // url reports an empty
+    // host as no host
+    if( pt.host_type ==
+            urls::host_type::name &&
+        pt.length(id_host) == 0)
+        pt.host_type =
+            urls::host_type::none;
+}
+
+void
+parse_origin(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    parse_dfa(s, dfa::uri, pt, ec);
+}
+
+void
+parse_scheme(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    if( ! parse_pieces(pt,
+            dfa::uri, s, ":") ||
+        pt.length(id_scheme) !=
+            s.size() + 1)
+        ec = error::invalid;
+}
+
+void
+parse_authority(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    if( ! parse_pieces(pt,
+            dfa::relative_ref, "//", s) ||
+        pt.offset[id_path] !=
+            s.size() + 2)
+        ec = error::invalid;
+}
+
+void
+parse_userinfo(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    // the host must come
+    // right after the '@'
+    if( ! parse_pieces(pt,
+            dfa::relative_ref, "//", s, "@") ||
+        pt.offset[id_host] !=
+            s.size() + 3 ||
+        pt.offset[id_end] !=
+            s.size() + 3)
+        ec = error::invalid;
+}
+
+void
+parse_hostname(
+    parts& pt,
+    string_view s,
+    error_code& ec) noexcept
+{
+    if( ! parse_pieces(pt,
+            dfa::relative_ref, "//", s) ||
+        pt.offset[id_host] != 2 ||
+        pt.offset[id_port] !=
+            s.size() + 2 ||
+        pt.offset[id_end] !=
+            s.size() + 2)
+        ec = error::invalid;
+}
+
+void
+parse_plain_hostname(
+    parts& pt,
+    string_view s) noexcept
+{
+    if( parse_pieces(pt,
+            dfa::relative_ref, "//", s) &&
+        pt.offset[id_host] == 2 &&
+        pt.offset[id_port] ==
+            s.size() + 2 &&
+        pt.offset[id_end] ==
+            s.size() + 2)
+        return;
+    // anything else is
+    // encoded as a reg-name
+    pt.host_type =
+        urls::host_type::name;
+}
+
+void
+match_port(
+    string_view s,
+    error_code& ec) noexcept
+{
+    parts pt;
+    if( ! parse_pieces(pt,
+            dfa::relative_ref, "//:", s) ||
+        pt.offset[id_path] !=
+            s.size() + 3)
+        ec = error::invalid;
+}
+
+void
+match_path_abempty(
+    string_view s,
+    error_code& ec) noexcept
+{
+    parts pt;
+    if( ! parse_pieces(pt,
+            dfa::relative_ref, "//", s) ||
+        pt.offset[id_path] != 2 ||
+        pt.offset[id_query] !=
+            s.size() + 2 ||
+        pt.offset[id_end] !=
+            s.size() + 2)
+        ec = error::invalid;
+}
+
+void
+match_path_absolute(
+    string_view s,
+    error_code& ec) noexcept
+{
+    parts pt;
+    if( s.starts_with("//") ||
+        ! parse_pieces(pt,
+            dfa::relative_ref, s, {}) ||
+        pt.offset[id_query] !=
+            s.size() ||
+        pt.offset[id_end] !=
+            s.size())
+        ec = error::invalid;
+}
+
+void
+match_path_noscheme(
+    string_view s,
+    error_code& ec) noexcept
+{
+    parts pt;
+    if( s.starts_with('/') ||
+        ! parse_pieces(pt,
+            dfa::relative_ref, s, {}) ||
+        pt.offset[id_query] !=
+            s.size() ||
+        pt.offset[id_end] !=
+            s.size())
+        ec = error::invalid;
+}
+
+void
+match_path_rootless(
+    string_view s,
+    error_code& ec) noexcept
+{
+    parts pt;
+    if( s.starts_with('/') ||
+        ! parse_pieces(pt,
+            dfa::uri, "x:", s) ||
+        pt.offset[id_query] !=
+            s.size() + 2 ||
+        pt.offset[id_end] !=
+            s.size() + 2)
+        ec = error::invalid;
+}
+
+std::size_t
+path_segments(string_view s) noexcept
+{
+    if(s.empty())
+        return 0;
+    return std::count(
+        s.begin(), s.end(), '/') + (
+            s.front() != '/');
+}
+
+std::size_t
+query_params_count(string_view s) noexcept
+{
+    return std::count(
+        s.begin(), s.end(), '&') + 1;
+}
+
 } // detail
 } // urls
 } // boost
@@ -0,0 +1,793 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_SIMD_IPP
+#define BOOST_URL_DETAIL_IMPL_SIMD_IPP
+
+#include <boost/url/detail/simd.hpp>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SIMD
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+# include <immintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace simd {
+
+using find_fn = char const*(*)(
+    char const*, char const*,
+    nibble_set const&);
+
+template<bool Found>
+char const*
+find_scalar(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    while(first != last)
+    {
+        if(ns.contains(*first) == Found)
+            break;
+        ++first;
+    }
+    return first;
+}
+
+using decode_fn = char*(*)(
+    char*, char*, char const*, char const*);
+
+// the value of a HEXDIG, without
+// checking that it is one
+inline
+unsigned char
+hex_nibble(char c) noexcept
+{
+    auto const u = static_cast<
+        unsigned char>(c);
+    return static_cast<unsigned char>(
+        (u & 0xf) + 9 * (u >> 6));
+}
+
+inline
+char*
+decode_scalar(
+    char* out,
+    char*,
+    char const* first,
+    char const* const last) noexcept
+{
+    while(first != last)
+    {
+        // copy up to the next escape
+        auto p = static_cast<char const*>(
+            std::memchr(first, '%',
+                last - first));
+        if(! p)
+            p = last;
+        std::memcpy(out, first, p - first);
+        out += p - first;
+        first = p;
+        while( first != last &&
+            *first == '%')
+        {
+            BOOST_ASSERT(last - first >= 3);
+            *out++ = static_cast<char>(
+                (hex_nibble(first[1]) << 4) |
+                hex_nibble(first[2]));
+            first += 3;
+        }
+    }
+    return out;
+}
+
+using encoded_size_fn = std::size_t(*)(
+    char const*, char const*,
+    nibble_set const&);
+
+using encode_fn = char*(*)(
+    char*, char*, char const*,
+    char const*, nibble_set const&);
+
+inline
+std::size_t
+encoded_size_scalar(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    std::size_t n = 0;
+    while(first != last)
+        n += 3 - 2 * ns.contains(*first++);
+    return n;
+}
+
+inline
+char*
+encode_scalar(
+    char* out,
+    char*,
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    static constexpr char hex[] =
+        "0123456789ABCDEF";
+    while(first != last)
+    {
+        // copy up to the next special
+        auto const p =
+            find_scalar<false>(
+                first, last, ns);
+        std::memcpy(out, first, p - first);
+        out += p - first;
+        first = p;
+        while( first != last &&
+            ! ns.contains(*first))
+        {
+            auto const u = static_cast<
+                unsigned char>(*first++);
+            out[0] = '%';
+            out[1] = hex[u >> 4];
+            out[2] = hex[u & 0xf];
+            out += 3;
+        }
+    }
+    return out;
+}
+
+#ifdef BOOST_URL_USE_SIMD
+
+inline
+unsigned
+ctz(unsigned v) noexcept
+{
+    BOOST_ASSERT(v != 0);
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, v);
+    return static_cast<unsigned>(i);
+#else
+    return static_cast<unsigned>(
+        __builtin_ctz(v));
+#endif
+}
+
+// Returns a bitmask with one bit
+// per byte, set when the byte is
+// not in the set.
+BOOST_URL_TARGET("ssse3")
+inline
+unsigned
+classify16(
+    __m128i v,
+    __m128i lut) noexcept
+{
+    __m128i const hibit = _mm_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128,
+        0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i const m = _mm_set1_epi8(0xf);
+    __m128i const lo = _mm_shuffle_epi8(
+        lut, _mm_and_si128(v, m));
+    __m128i const hi = _mm_shuffle_epi8(
+        hibit, _mm_and_si128(
+            _mm_srli_epi16(v, 4), m));
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(lo, hi),
+            _mm_setzero_si128())));
+}
+
+BOOST_URL_TARGET("avx2")
+inline
+unsigned
+classify32(
+    __m256i v,
+    __m256i lut) noexcept
+{
+    __m256i const hibit = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 4, 8, 16, 32, 64, -128,
+        0, 0, 0, 0, 0, 0, 0, 0);
+    __m256i const m = _mm256_set1_epi8(0xf);
+    __m256i const lo = _mm256_shuffle_epi8(
+        lut, _mm256_and_si256(v, m));
+    __m256i const hi = _mm256_shuffle_epi8(
+        hibit, _mm256_and_si256(
+            _mm256_srli_epi16(v, 4), m));
+    return static_cast<unsigned>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_and_si256(lo, hi),
+            _mm256_setzero_si256())));
+}
+
+template<bool Found>
+BOOST_URL_TARGET("ssse3")
+char const*
+find_ssse3(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m128i const lut = _mm_loadu_si128(
+        reinterpret_cast<
+            __m128i const*>(ns.lo));
+    while(last - first >= 16)
+    {
+        unsigned v = classify16(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(first)), lut);
+        if(Found)
+            v = ~v & 0xffff;
+        if(v != 0)
+            return first + ctz(v);
+        first += 16;
+    }
+    return find_scalar<Found>(
+        first, last, ns);
+}
+
+template<bool Found>
+BOOST_URL_TARGET("avx2")
+char const*
+find_avx2(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m128i const lut16 = _mm_loadu_si128(
+        reinterpret_cast<
+            __m128i const*>(ns.lo));
+    __m256i const lut =
+        _mm256_broadcastsi128_si256(lut16);
+    while(last - first >= 32)
+    {
+        unsigned v = classify32(
+            _mm256_loadu_si256(reinterpret_cast<
+                __m256i const*>(first)), lut);
+        if(Found)
+            v = ~v;
+        if(v != 0)
+            return first + ctz(v);
+        first += 32;
+    }
+    if(last - first >= 16)
+    {
+        unsigned v = classify16(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(first)), lut16);
+        if(Found)
+            v = ~v & 0xffff;
+        if(v != 0)
+            return first + ctz(v);
+        first += 16;
+    }
+    return find_scalar<Found>(
+        first, last, ns);
+}
+
+// Decode escapes at 0, 3, 6, 9, and 12 of
+// v, when v starts with an escape. Stores 16
+// bytes at out and returns how many of them
+// are decoded characters, with the input
+// advanced by three times as much.
+BOOST_URL_TARGET("ssse3")
+inline
+unsigned
+decode_escapes16(
+    char* out,
+    __m128i v,
+    unsigned pct) noexcept
+{
+    // count the escapes in a row
+    unsigned k = 1;
+    while(k < 5 && ((pct >> (3 * k)) & 1))
+        ++k;
+    // value of every byte as a HEXDIG
+    __m128i const lo4 = _mm_and_si128(
+        v, _mm_set1_epi8(0xf));
+    __m128i const alpha = _mm_and_si128(
+        _mm_srli_epi16(v, 6),
+        _mm_set1_epi8(1));
+    __m128i const x = _mm_add_epi8(lo4,
+        _mm_mullo_epi16(alpha,
+            _mm_set1_epi16(9)));
+    // gather the digit pairs and join them
+    __m128i const hi = _mm_shuffle_epi8(x,
+        _mm_setr_epi8(1, 4, 7, 10, 13,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+    __m128i const lo = _mm_shuffle_epi8(x,
+        _mm_setr_epi8(2, 5, 8, 11, 14,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+    __m128i const r = _mm_or_si128(
+        _mm_slli_epi16(hi, 4), lo);
+    _mm_storeu_si128(reinterpret_cast<
+        __m128i*>(out), r);
+    return k;
+}
+
+BOOST_URL_TARGET("ssse3")
+char*
+decode_ssse3(
+    char* out,
+    char* const out_last,
+    char const* first,
+    char const* const last) noexcept
+{
+    __m128i const pct =
+        _mm_set1_epi8('%');
+    // every store is a full vector, so
+    // both sides need room for one
+    while(
+        last - first >= 16 &&
+        out_last - out >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<
+                __m128i const*>(first));
+        unsigned const m = static_cast<
+            unsigned>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, pct)));
+        if(m == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<
+                __m128i*>(out), v);
+            out += 16;
+            first += 16;
+            continue;
+        }
+        auto const n = ctz(m);
+        if(n != 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<
+                __m128i*>(out), v);
+            out += n;
+            first += n;
+            continue;
+        }
+        auto const k =
+            decode_escapes16(out, v, m);
+        out += k;
+        first += 3 * k;
+    }
+    return decode_scalar(
+        out, out_last, first, last);
+}
+
+BOOST_URL_TARGET("avx2")
+char*
+decode_avx2(
+    char* out,
+    char* const out_last,
+    char const* first,
+    char const* const last) noexcept
+{
+    __m256i const pct =
+        _mm256_set1_epi8('%');
+    while(
+        last - first >= 32 &&
+        out_last - out >= 32)
+    {
+        __m256i const v = _mm256_loadu_si256(
+            reinterpret_cast<
+                __m256i const*>(first));
+        unsigned const m = static_cast<
+            unsigned>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(v, pct)));
+        if(m == 0)
+        {
+            _mm256_storeu_si256(reinterpret_cast<
+                __m256i*>(out), v);
+            out += 32;
+            first += 32;
+            continue;
+        }
+        auto const n = ctz(m);
+        if(n != 0)
+        {
+            _mm256_storeu_si256(reinterpret_cast<
+                __m256i*>(out), v);
+            out += n;
+            first += n;
+            continue;
+        }
+        auto const k = decode_escapes16(out,
+            _mm256_castsi256_si128(v), m);
+        out += k;
+        first += 3 * k;
+    }
+    return decode_ssse3(
+        out, out_last, first, last);
+}
+
+inline
+unsigned
+popcount(unsigned v) noexcept
+{
+#ifdef _MSC_VER
+    // __popcnt needs the POPCNT
+    // instruction, which SSSE3
+    // does not imply
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) +
+        ((v >> 2) & 0x33333333);
+    return (((v + (v >> 4)) &
+        0x0f0f0f0f) * 0x01010101) >> 24;
+#else
+    return static_cast<unsigned>(
+        __builtin_popcount(v));
+#endif
+}
+
+BOOST_URL_TARGET("ssse3")
+std::size_t
+encoded_size_ssse3(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m128i const lut = _mm_loadu_si128(
+        reinterpret_cast<
+            __m128i const*>(ns.lo));
+    std::size_t n = last - first;
+    while(last - first >= 16)
+    {
+        n += 2 * popcount(classify16(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(first)), lut));
+        first += 16;
+    }
+    return n - (last - first) +
+        encoded_size_scalar(
+            first, last, ns);
+}
+
+BOOST_URL_TARGET("avx2")
+std::size_t
+encoded_size_avx2(
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m256i const lut =
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(ns.lo)));
+    std::size_t n = last - first;
+    while(last - first >= 32)
+    {
+        n += 2 * popcount(classify32(
+            _mm256_loadu_si256(reinterpret_cast<
+                __m256i const*>(first)), lut));
+        first += 32;
+    }
+    return n - (last - first) +
+        encoded_size_ssse3(
+            first, last, ns);
+}
+
+// Escape the characters at 0 through
+// 4 of v. Stores 16 bytes at out, of
+// which the first 15 are the escapes.
+BOOST_URL_TARGET("ssse3")
+inline
+void
+encode_escapes16(
+    char* out,
+    __m128i v) noexcept
+{
+    __m128i const hex = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    __m128i const m = _mm_set1_epi8(0xf);
+    __m128i const hi = _mm_shuffle_epi8(hex,
+        _mm_and_si128(_mm_srli_epi16(v, 4), m));
+    __m128i const lo = _mm_shuffle_epi8(hex,
+        _mm_and_si128(v, m));
+    // h0 l0 h1 l1 ... spread out
+    // to make room for the '%'
+    __m128i const r = _mm_or_si128(
+        _mm_shuffle_epi8(
+            _mm_unpacklo_epi8(hi, lo),
+            _mm_setr_epi8(
+                -1, 0, 1, -1, 2, 3, -1, 4,
+                5, -1, 6, 7, -1, 8, 9, -1)),
+        _mm_setr_epi8(
+            '%', 0, 0, '%', 0, 0, '%', 0,
+            0, '%', 0, 0, '%', 0, 0, 0));
+    _mm_storeu_si128(reinterpret_cast<
+        __m128i*>(out), r);
+}
+
+BOOST_URL_TARGET("ssse3")
+char*
+encode_ssse3(
+    char* out,
+    char* const out_last,
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m128i const lut = _mm_loadu_si128(
+        reinterpret_cast<
+            __m128i const*>(ns.lo));
+    while(
+        last - first >= 16 &&
+        out_last - out >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<
+                __m128i const*>(first));
+        unsigned const m = classify16(v, lut);
+        if(m == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<
+                __m128i*>(out), v);
+            out += 16;
+            first += 16;
+            continue;
+        }
+        auto const n = ctz(m);
+        if(n != 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<
+                __m128i*>(out), v);
+            out += n;
+            first += n;
+            continue;
+        }
+        // up to five specials in a row
+        auto const k = ctz(~m | 0x20);
+        encode_escapes16(out, v);
+        out += 3 * k;
+        first += k;
+    }
+    return encode_scalar(
+        out, out_last, first, last, ns);
+}
+
+BOOST_URL_TARGET("avx2")
+char*
+encode_avx2(
+    char* out,
+    char* const out_last,
+    char const* first,
+    char const* const last,
+    nibble_set const& ns) noexcept
+{
+    __m256i const lut =
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<
+                __m128i const*>(ns.lo)));
+    while(
+        last - first >= 32 &&
+        out_last - out >= 32)
+    {
+        __m256i const v = _mm256_loadu_si256(
+            reinterpret_cast<
+                __m256i const*>(first));
+        unsigned const m = classify32(v, lut);
+        if(m == 0)
+        {
+            _mm256_storeu_si256(reinterpret_cast<
+                __m256i*>(out), v);
+            out += 32;
+            first += 32;
+            continue;
+        }
+        auto const n = ctz(m);
+        if(n != 0)
+        {
+            _mm256_storeu_si256(reinterpret_cast<
+                __m256i*>(out), v);
+            out += n;
+            first += n;
+            continue;
+        }
+        auto const k = ctz(~m | 0x20);
+        encode_escapes16(out,
+            _mm256_castsi256_si128(v));
+        out += 3 * k;
+        first += k;
+    }
+    return encode_ssse3(
+        out, out_last, first, last, ns);
+}
+
+// 0 = none, 1 = SSSE3, 2 = AVX2
+inline
+int
+cpu_level() noexcept
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 0);
+    int const n = r[0];
+    if(n < 1)
+        return 0;
+    __cpuid(r, 1);
+    if((r[2] & (1 << 9)) == 0)
+        return 0;
+    // AVX2 also needs OS support
+    // for saving the YMM registers
+    if( n < 7 ||
+        (r[2] & (1 << 27)) == 0 ||
+        (r[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 6) != 6)
+        return 1;
+    __cpuidex(r, 7, 0);
+    if((r[1] & (1 << 5)) == 0)
+        return 1;
+    return 2;
+#else
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return 2;
+    if(__builtin_cpu_supports("ssse3"))
+        return 1;
+    return 0;
+#endif
+}
+
+#endif
+
+template<bool Found>
+find_fn
+select() noexcept
+{
+#ifdef BOOST_URL_USE_SIMD
+    switch(cpu_level())
+    {
+    case 2: return &find_avx2<Found>;
+    case 1: return &find_ssse3<Found>;
+    default:
+        break;
+    }
+#endif
+    return &find_scalar<Found>;
+}
+
+inline
+decode_fn
+select_decode() noexcept
+{
+#ifdef BOOST_URL_USE_SIMD
+    switch(cpu_level())
+    {
+    case 2: return &decode_avx2;
+    case 1: return &decode_ssse3;
+    default:
+        break;
+    }
+#endif
+    return &decode_scalar;
+}
+
+inline
+encoded_size_fn
+select_encoded_size() noexcept
+{
+#ifdef BOOST_URL_USE_SIMD
+    switch(cpu_level())
+    {
+    case 2: return &encoded_size_avx2;
+    case 1: return &encoded_size_ssse3;
+    default:
+        break;
+    }
+#endif
+    return &encoded_size_scalar;
+}
+
+inline
+encode_fn
+select_encode() noexcept
+{
+#ifdef BOOST_URL_USE_SIMD
+    switch(cpu_level())
+    {
+    case 2: return &encode_avx2;
+    case 1: return &encode_ssse3;
+    default:
+        break;
+    }
+#endif
+    return &encode_scalar;
+}
+
+} // simd
+
+//------------------------------------------------
+
+char const*
+simd_find_if(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept
+{
+    // not worth a vector
+    if(last - first < 16)
+        return simd::find_scalar<true>(
+            first, last, ns);
+    static simd::find_fn const f =
+        simd::select<true>();
+    return f(first, last, ns);
+}
+
+char const*
+simd_find_if_not(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept
+{
+    if(last - first < 16)
+        return simd::find_scalar<false>(
+            first, last, ns);
+    static simd::find_fn const f =
+        simd::select<false>();
+    return f(first, last, ns);
+}
+
+char*
+simd_pct_decode(
+    char* out,
+    char* out_last,
+    char const* first,
+    char const* last) noexcept
+{
+    if(out_last - out < 16)
+        return simd::decode_scalar(
+            out, out_last, first, last);
+    static simd::decode_fn const f =
+        simd::select_decode();
+    return f(out, out_last, first, last);
+}
+
+std::size_t
+simd_pct_encoded_size(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept
+{
+    if(last - first < 16)
+        return simd::encoded_size_scalar(
+            first, last, ns);
+    static simd::encoded_size_fn const f =
+        simd::select_encoded_size();
+    return f(first, last, ns);
+}
+
+char*
+simd_pct_encode(
+    char* out,
+    char* out_last,
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept
+{
+    if(out_last - out < 16)
+        return simd::encode_scalar(
+            out, out_last, first, last, ns);
+    static simd::encode_fn const f =
+        simd::select_encode();
+    return f(out, out_last, first, last, ns);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
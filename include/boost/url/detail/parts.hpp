@@ -37,6 +37,11 @@ enum part
 
 struct parts
 {
+    // a decoded size which must be
+    // computed from the string
+    static constexpr std::size_t
+        unknown = std::size_t(-1);
+
     std::size_t offset[id_end + 1];
     std::size_t decoded[id_end];
     unsigned char ip_addr[16];
@@ -58,11 +63,8 @@ struct parts
         host_type = urls::host_type::none;
         for(int i = 0; i <= id_end; ++i)
             offset[i] = 0;
-        // VFALCO This isn't really needed
-        /*
         for(int i = 0; i < id_end; ++i)
             decoded[i] = 0;
-        */
     }
 
     std::size_t
@@ -125,6 +127,8 @@ struct parts
         BOOST_ASSERT(n <= length(id));
         offset[id + 1] = offset[id] +
             static_cast<std::size_t>(n);
+        decoded[id] = unknown;
+        decoded[id + 1] = unknown;
     }
 };
 
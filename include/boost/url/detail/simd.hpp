@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_SIMD_HPP
+#define BOOST_URL_DETAIL_SIMD_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A set of 7-bit characters laid out
+// for nibble lookup. Bit `h` of lo[n]
+// is set when the character with high
+// nibble h and low nibble n is in the
+// set. Characters above 0x7f are never
+// in the set.
+struct nibble_set
+{
+    unsigned char lo[16];
+
+    bool
+    contains(char c) const noexcept
+    {
+        auto const u = static_cast<
+            unsigned char>(c);
+        return u < 128 && ((lo[
+            u & 0xf] >> (u >> 4)) & 1) != 0;
+    }
+};
+
+// Return the first character in the
+// range which is in the set.
+BOOST_URL_DECL
+char const*
+simd_find_if(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept;
+
+// Return the first character in the
+// range which is not in the set.
+BOOST_URL_DECL
+char const*
+simd_find_if_not(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept;
+
+// Percent-decode the valid encoded string
+// [first, last) to [out, out_last), which
+// holds exactly the decoded size. Returns
+// one past the last character written.
+BOOST_URL_DECL
+char*
+simd_pct_decode(
+    char* out,
+    char* out_last,
+    char const* first,
+    char const* last) noexcept;
+
+// Return the size of [first, last) after
+// percent-encoding every character which
+// is not in the set.
+BOOST_URL_DECL
+std::size_t
+simd_pct_encoded_size(
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept;
+
+// Percent-encode every character in
+// [first, last) which is not in the set,
+// to [out, out_last), which holds exactly
+// the encoded size. Returns one past the
+// last character written.
+BOOST_URL_DECL
+char*
+simd_pct_encode(
+    char* out,
+    char* out_last,
+    char const* first,
+    char const* last,
+    nibble_set const& ns) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
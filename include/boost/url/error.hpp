@@ -135,7 +135,13 @@ enum class error
     incomplete_pct_encoding,
 
     /// Illegal reserved character in encoded string.
-    illegal_reserved_char
+    illegal_reserved_char,
+
+    /// A number is too large for its type.
+    number_overflow,
+
+    /// The result does not fit in a fixed capacity.
+    capacity_exceeded
 };
 
 enum class condition
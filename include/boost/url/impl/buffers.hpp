@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_BUFFERS_HPP
+#define BOOST_URL_IMPL_BUFFERS_HPP
+
+#include <boost/url/detail/buffers.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+template<class Buffer>
+string_view
+buffer_string(Buffer const& b) noexcept
+{
+    return string_view(
+        static_cast<char const*>(
+            static_cast<void const*>(
+                b.data())), b.size());
+}
+
+// Returns the contiguous input, or
+// null if the input is invalid
+template<class ConstBufferSequence>
+char const*
+parse_buffers(
+    buffers_parser& pr,
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec)
+{
+    for(auto const& b : buffers)
+        if(! pr.write(
+                buffer_string(b), ec))
+            return nullptr;
+    if(! pr.finish(ec))
+        return nullptr;
+    if(pr.contiguous())
+        return pr.data();
+    auto const p = pool.allocator(
+        ).allocate(pr.size());
+    auto dest = p;
+    for(auto const& b : buffers)
+    {
+        auto const s = buffer_string(b);
+        if(s.empty())
+            continue;
+        std::memcpy(dest,
+            s.data(), s.size());
+        dest += s.size();
+    }
+    return p;
+}
+
+} // detail
+
+template<class ConstBufferSequence>
+url_view
+parse_uri(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec)
+{
+    detail::buffers_parser pr(
+        url_parser::uri);
+    auto const p = detail::parse_buffers(
+        pr, buffers, pool, ec);
+    if(! p)
+        return {};
+    return pr.url(p);
+}
+
+template<class ConstBufferSequence>
+url_view
+parse_relative_ref(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec)
+{
+    detail::buffers_parser pr(
+        url_parser::relative_ref);
+    auto const p = detail::parse_buffers(
+        pr, buffers, pool, ec);
+    if(! p)
+        return {};
+    return pr.url(p);
+}
+
+template<class ConstBufferSequence>
+query_params_view
+parse_query_params(
+    ConstBufferSequence const& buffers,
+    basic_static_pool& pool,
+    error_code& ec)
+{
+    detail::buffers_parser pr;
+    auto const p = detail::parse_buffers(
+        pr, buffers, pool, ec);
+    if(! p)
+        return {};
+    return pr.params(p);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -117,6 +117,9 @@ case error::missing_port: return "missing port";
 case error::bad_pct_encoding_digit: return "bad pct-encoding digit";
 case error::incomplete_pct_encoding: return "incomplete pct-encoding";
 case error::illegal_reserved_char: return "illegal reserved char";
+case error::number_overflow: return "number overflow";
+
+case error::capacity_exceeded: return "capacity exceeded";
             }
         }
 
@@ -146,6 +149,7 @@ case error::missing_port:
 case error::bad_pct_encoding_digit:
 case error::incomplete_pct_encoding:
 case error::illegal_reserved_char:
+case error::number_overflow:
     return condition::parse_error;
             }
         }
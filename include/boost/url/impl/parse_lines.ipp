@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PARSE_LINES_IPP
+#define BOOST_URL_IMPL_PARSE_LINES_IPP
+
+#include <boost/url/parse_lines.hpp>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+// Split text into pieces of about n
+// bytes, each ending just past a '\n'
+// or at the end of the text.
+inline
+void
+split_lines(
+    std::vector<parsed_lines::chunk>& v,
+    string_view text,
+    std::size_t n)
+{
+    auto p = text.data();
+    auto const end = p + text.size();
+    while(p != end)
+    {
+        auto q = p;
+        if(static_cast<std::size_t>(
+            end - p) > n)
+        {
+            q = static_cast<char const*>(
+                std::memchr(p + n - 1, '\n',
+                    end - (p + n - 1)));
+            q = q ? q + 1 : end;
+        }
+        else
+        {
+            q = end;
+        }
+        v.emplace_back();
+        v.back().text = string_view(
+            p, q - p);
+        p = q;
+    }
+}
+
+inline
+void
+parse_chunk(
+    parsed_lines::chunk& c,
+    parsed_lines::worker& w,
+    url_view (*parse)(
+        string_view, error_code&))
+{
+    // Results are gathered in locals and
+    // stored once at the end. parse is
+    // opaque, so writes through c and w
+    // could not stay in registers, and
+    // neighbouring workers and chunks
+    // share cache lines across threads.
+    std::size_t lines = 0;
+    std::size_t errors = 0;
+    std::vector<url_view> urls;
+    std::vector<string_view> failures;
+    auto p = c.text.data();
+    auto const end = p + c.text.size();
+    while(p != end)
+    {
+        auto q = static_cast<char const*>(
+            std::memchr(p, '\n', end - p));
+        auto const next = q ? q + 1 : end;
+        if(! q)
+            q = end;
+        if(q != p && q[-1] == '\r')
+            --q;
+        if(q != p)
+        {
+            string_view s(p, q - p);
+            error_code ec;
+            auto const u = parse(s, ec);
+            ++lines;
+            if(! ec)
+            {
+                urls.push_back(u);
+            }
+            else
+            {
+                failures.push_back(s);
+                ++errors;
+            }
+        }
+        p = next;
+    }
+    c.urls = std::move(urls);
+    c.failures = std::move(failures);
+    w.lines += lines;
+    w.errors += errors;
+    ++w.chunks;
+}
+
+inline
+parsed_lines
+parse_lines(
+    string_view text,
+    std::size_t threads,
+    std::size_t chunk_size,
+    url_view (*parse)(
+        string_view, error_code&))
+{
+    if(threads == 0)
+    {
+        threads = std::thread::
+            hardware_concurrency();
+        if(threads == 0)
+            threads = 1;
+    }
+    if(chunk_size == 0)
+    {
+        // enough chunks per thread to even
+        // out the load, but not so small
+        // that handing them out dominates
+        chunk_size = text.size() /
+            (threads * 16) + 1;
+        if(chunk_size < 65536)
+            chunk_size = 65536;
+    }
+
+    parsed_lines r;
+    split_lines(r.chunks, text, chunk_size);
+    if(threads > r.chunks.size())
+        threads = r.chunks.size();
+    if(threads == 0)
+        threads = 1;
+    r.workers.resize(threads);
+
+    // Each thread claims the next unparsed
+    // chunk when it finishes the previous
+    // one, so faster threads take more.
+    std::atomic<std::size_t> next(0);
+    std::vector<std::exception_ptr> ep(threads);
+    auto const work =
+        [&](std::size_t t)
+        {
+            try
+            {
+                for(;;)
+                {
+                    auto const i = next.fetch_add(
+                        1, std::memory_order_relaxed);
+                    if(i >= r.chunks.size())
+                        break;
+                    parse_chunk(r.chunks[i],
+                        r.workers[t], parse);
+                }
+            }
+            catch(...)
+            {
+                ep[t] = std::current_exception();
+                next = r.chunks.size();
+            }
+        };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    try
+    {
+        for(std::size_t t = 1; t < threads; ++t)
+            pool.emplace_back(work, t);
+    }
+    catch(...)
+    {
+        // fewer threads than asked for
+        // is fine, the rest still run
+    }
+    work(0);
+    for(auto& th : pool)
+        th.join();
+    for(auto const& e : ep)
+        if(e)
+            std::rethrow_exception(e);
+    return r;
+}
+
+} // detail
+
+parsed_lines
+parse_uri_lines(
+    string_view text,
+    std::size_t threads,
+    std::size_t chunk_size)
+{
+    return detail::parse_lines(
+        text, threads, chunk_size,
+        &parse_uri);
+}
+
+parsed_lines
+parse_relative_ref_lines(
+    string_view text,
+    std::size_t threads,
+    std::size_t chunk_size)
+{
+    return detail::parse_lines(
+        text, threads, chunk_size,
+        &parse_relative_ref);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PATH_INDEX_IPP
+#define BOOST_URL_IMPL_PATH_INDEX_IPP
+
+#include <boost/url/path_index.hpp>
+#include <boost/url/rfc/pct_encoding.hpp>
+#include <boost/url/detail/except.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+path_index::
+path_index(
+    path_view p,
+    std::size_t* buf,
+    std::size_t buf_size)
+    : s_(p.s_.data())
+    , off_(buf)
+    , n_(p.size())
+{
+    if(buf_size < buffer_size(p))
+        detail::throw_length_error(
+            "path_index buffer too small",
+            BOOST_CURRENT_LOCATION);
+    if(n_ == 0)
+        return;
+    auto const end =
+        p.s_.data() + p.s_.size();
+    auto it = s_;
+    if(*it == '/')
+        ++it;
+    std::size_t i = 0;
+    for(;;)
+    {
+        BOOST_ASSERT(i < n_);
+        off_[i++] = it - s_;
+        auto const e = static_cast<
+            char const*>(std::memchr(
+                it, '/', end - it));
+        if(! e)
+            break;
+        it = e + 1;
+    }
+    BOOST_ASSERT(i == n_);
+    // as if followed by a '/'
+    off_[n_] = p.s_.size() + 1;
+}
+
+auto
+path_index::
+operator[](
+    std::size_t i) const noexcept ->
+        value_type
+{
+    value_type v;
+    v.s_.str = encoded_segment(i);
+    v.s_.decoded_size =
+        pct_decoded_size_unchecked(
+            v.s_.str);
+    return v;
+}
+
+} // urls
+} // boost
+
+#endif
@@ -11,6 +11,9 @@
 #define BOOST_URL_IMPL_PATH_VIEW_HPP
 
 #include <boost/url/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <iterator>
 
 namespace boost {
 namespace urls {
@@ -18,30 +21,33 @@ namespace urls {
 class path_view::iterator
 {
     path_view::value_type v_;
+    char const* begin_ = nullptr;
     char const* next_ = nullptr;
     char const* end_ = nullptr;
 
     friend path_view;
 
     BOOST_URL_DECL
-    explicit
     iterator(
-        string_view s);
+        string_view s,
+        bool end) noexcept;
 
-    explicit
-    iterator(
-        char const* end) noexcept
-        : end_(end)
-    {
-    }
+    BOOST_URL_DECL
+    void
+    read(char const* p) noexcept;
+
+    BOOST_URL_DECL
+    void
+    read_back(char const* e) noexcept;
 
 public:
     using value_type =
         path_view::value_type;
     using pointer = value_type const*;
     using reference = value_type const&;
+    using difference_type = std::ptrdiff_t;
     using iterator_category =
-        std::forward_iterator_tag;
+        std::bidirectional_iterator_tag;
 
     iterator() noexcept = default;
     iterator(
@@ -88,8 +94,42 @@ public:
         ++*this;
         return tmp;
     }
+
+    BOOST_URL_DECL
+    iterator&
+    operator--() noexcept;
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
 };
 
+//------------------------------------------------
+
+inline
+auto
+path_view::
+front() const noexcept ->
+    value_type
+{
+    BOOST_ASSERT(! empty());
+    return *begin();
+}
+
+inline
+auto
+path_view::
+back() const noexcept ->
+    value_type
+{
+    BOOST_ASSERT(! empty());
+    return *--end();
+}
+
 } // urls
 } // boost
 
@@ -15,6 +15,7 @@
 #include <boost/url/rfc/query_bnf.hpp>
 #include <boost/url/rfc/detail/paths_bnf.hpp>
 #include <boost/url/detail/except.hpp>
+#include <cstring>
 
 namespace boost {
 namespace urls {
@@ -26,25 +27,63 @@ path_view() noexcept
 {
 }
 
+// The view is only ever made from a
+// path which was already validated,
+// so iterating only has to split on
+// '/'. The leading '/' of an absolute
+// path is not part of any segment.
+
 path_view::
 iterator::
 iterator(
-    string_view s)
-    : next_(s.data())
+    string_view s,
+    bool end) noexcept
+    : begin_(s.data())
     , end_(s.data() + s.size())
 {
-    if(next_ == end_)
-    {
-        next_ = nullptr;
+    if(end || begin_ == end_)
         return;
+    auto p = begin_;
+    if(*p == '/')
+        ++p;
+    read(p);
+}
+
+// read the segment starting at p
+void
+path_view::
+iterator::
+read(char const* p) noexcept
+{
+    auto e = static_cast<char const*>(
+        std::memchr(p, '/', end_ - p));
+    if(! e)
+        e = end_;
+    v_.s_.str = string_view(p, e - p);
+    v_.s_.decoded_size =
+        pct_decoded_size_unchecked(
+            v_.s_.str);
+    next_ = e;
+}
+
+// read the segment ending at e
+void
+path_view::
+iterator::
+read_back(char const* e) noexcept
+{
+    auto p = e;
+    while(p != begin_)
+    {
+        if(p[-1] == '/')
+            break;
+        --p;
     }
-    error_code ec;
-    detail::
-        path_abempty_bnf::begin(
-            next_, end_, ec, v_.s_);
-    if(ec)
-        detail::throw_system_error(
-            ec, BOOST_CURRENT_LOCATION);
+    v_.s_.str = string_view(p, e - p);
+    v_.s_.decoded_size =
+        pct_decoded_size_unchecked(
+            v_.s_.str);
+    next_ = e;
 }
 
 auto
@@ -53,18 +92,33 @@ iterator::
 operator++() noexcept ->
     iterator&
 {
-    error_code ec;
-    detail::
-        path_abempty_bnf::increment(
-            next_, end_, ec, v_.s_);
-    if(ec == error::end)
+    BOOST_ASSERT(next_ != nullptr);
+    if(next_ == end_)
     {
         next_ = nullptr;
         return *this;
     }
-    if(ec)
-        detail::throw_system_error(
-            ec, BOOST_CURRENT_LOCATION);
+    // skip '/'
+    read(next_ + 1);
+    return *this;
+}
+
+auto
+path_view::
+iterator::
+operator--() noexcept ->
+    iterator&
+{
+    if(next_ == nullptr)
+    {
+        BOOST_ASSERT(begin_ != end_);
+        read_back(end_);
+        return *this;
+    }
+    // the '/' before this segment
+    auto const p = v_.s_.str.data();
+    BOOST_ASSERT(p != begin_);
+    read_back(p - 1);
     return *this;
 }
 
@@ -75,7 +129,7 @@ path_view::
 begin() const noexcept ->
     iterator
 {
-    return iterator(s_);
+    return iterator(s_, false);
 }
 
 auto
@@ -83,8 +137,7 @@ path_view::
 end() const noexcept ->
     iterator
 {
-    return iterator(
-        s_.data() + s_.size());
+    return iterator(s_, true);
 }
 
 //------------------------------------------------
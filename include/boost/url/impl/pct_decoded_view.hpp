@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PCT_DECODED_VIEW_HPP
+#define BOOST_URL_IMPL_PCT_DECODED_VIEW_HPP
+
+#include <boost/url/detail/except.hpp>
+#include <limits>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+auto
+pct_decoded_view::
+begin() const noexcept ->
+    iterator
+{
+    return iterator(p_, p_);
+}
+
+auto
+pct_decoded_view::
+end() const noexcept ->
+    iterator
+{
+    return iterator(p_, p_ + n_);
+}
+
+template<class Allocator>
+string_type<Allocator>
+pct_decoded_view::
+to_string(
+    Allocator const& a) const
+{
+    string_type<Allocator> s(a);
+    if(dn_ == 0)
+        return s;
+    s.resize(dn_);
+    copy(&s[0], dn_);
+    return s;
+}
+
+template<class Unsigned>
+Unsigned
+pct_decoded_view::
+to_number(
+    error_code& ec) const noexcept
+{
+    static_assert(
+        std::is_unsigned<Unsigned>::value,
+        "Unsigned requirements not met");
+    if(dn_ == 0)
+    {
+        ec = error::syntax;
+        return 0;
+    }
+    Unsigned const max =
+        (std::numeric_limits<
+            Unsigned>::max)();
+    Unsigned v = 0;
+    for(char c : *this)
+    {
+        if(c < '0' || c > '9')
+        {
+            ec = error::syntax;
+            return 0;
+        }
+        Unsigned const d =
+            static_cast<Unsigned>(c - '0');
+        if( v > max / 10 ||
+            v * 10 > max - d)
+        {
+            ec = error::number_overflow;
+            return 0;
+        }
+        v = static_cast<Unsigned>(
+            v * 10 + d);
+    }
+    ec = {};
+    return v;
+}
+
+template<class Unsigned>
+Unsigned
+pct_decoded_view::
+to_number() const
+{
+    error_code ec;
+    auto const v =
+        to_number<Unsigned>(ec);
+    if(ec)
+        detail::throw_system_error(
+            ec, BOOST_CURRENT_LOCATION);
+    return v;
+}
+
+} // urls
+} // boost
+
+#endif
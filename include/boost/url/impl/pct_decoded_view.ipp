@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PCT_DECODED_VIEW_IPP
+#define BOOST_URL_IMPL_PCT_DECODED_VIEW_IPP
+
+#include <boost/url/pct_decoded_view.hpp>
+#include <boost/url/bnf/char_set.hpp>
+#include <boost/url/rfc/pct_encoding.hpp>
+#include <boost/url/detail/hash.hpp>
+#include <boost/url/detail/simd.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+
+pct_decoded_view::
+pct_decoded_view(
+    string_view s) noexcept
+    : p_(s.data())
+    , n_(s.size())
+    , dn_(pct_decoded_size_unchecked(s))
+{
+}
+
+pct_decoded_view::
+pct_decoded_view(
+    string_view s,
+    std::size_t decoded_size) noexcept
+    : p_(s.data())
+    , n_(s.size())
+    , dn_(decoded_size)
+{
+    BOOST_ASSERT(decoded_size ==
+        pct_decoded_size_unchecked(s));
+}
+
+std::size_t
+pct_decoded_view::
+copy(
+    char* dest,
+    std::size_t count) const noexcept
+{
+    if(count >= dn_)
+    {
+        // whole string, let
+        // the kernel do it
+        detail::simd_pct_decode(
+            dest, dest + dn_,
+            p_, p_ + n_);
+        return dn_;
+    }
+    auto it = begin();
+    for(std::size_t i = 0;
+            i < count; ++i, ++it)
+        dest[i] = *it;
+    return count;
+}
+
+std::size_t
+pct_decoded_view::
+decode_into(
+    char* first,
+    char* last) const noexcept
+{
+    if(static_cast<std::size_t>(
+            last - first) >= dn_)
+        detail::simd_pct_decode(
+            first, first + dn_,
+            p_, p_ + n_);
+    return dn_;
+}
+
+int
+pct_decoded_view::
+compare(string_view s) const noexcept
+{
+    auto it = begin();
+    auto const last = end();
+    auto p = s.data();
+    auto const p_end = p + s.size();
+    for(;;)
+    {
+        if(it == last)
+            return p == p_end ? 0 : -1;
+        if(p == p_end)
+            return 1;
+        auto const c0 = static_cast<
+            unsigned char>(*it);
+        auto const c1 = static_cast<
+            unsigned char>(*p);
+        if(c0 != c1)
+            return c0 < c1 ? -1 : 1;
+        ++it;
+        ++p;
+    }
+}
+
+int
+pct_decoded_view::
+compare(
+    pct_decoded_view const& other) const noexcept
+{
+    auto it0 = begin();
+    auto const last0 = end();
+    auto it1 = other.begin();
+    auto const last1 = other.end();
+    for(;;)
+    {
+        if(it0 == last0)
+            return it1 == last1 ? 0 : -1;
+        if(it1 == last1)
+            return 1;
+        auto const c0 = static_cast<
+            unsigned char>(*it0);
+        auto const c1 = static_cast<
+            unsigned char>(*it1);
+        if(c0 != c1)
+            return c0 < c1 ? -1 : 1;
+        ++it0;
+        ++it1;
+    }
+}
+
+// FNV-1a over the decoded characters
+std::size_t
+pct_decoded_view::
+hash() const noexcept
+{
+    return detail::hash_chars(*this);
+}
+
+//------------------------------------------------
+
+char
+pct_decoded_view::
+iterator::
+operator*() const noexcept
+{
+    if(*p_ != '%')
+        return *p_;
+    return static_cast<char>(
+        (bnf::hexdig_value(p_[1]) << 4) +
+        bnf::hexdig_value(p_[2]));
+}
+
+} // urls
+} // boost
+
+#endif
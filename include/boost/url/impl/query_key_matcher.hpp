@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_QUERY_KEY_MATCHER_HPP
+#define BOOST_URL_IMPL_QUERY_KEY_MATCHER_HPP
+
+namespace boost {
+namespace urls {
+
+template<class Handler>
+void
+for_each_query_param(
+    query_params_view qp,
+    query_key_matcher const& m,
+    Handler&& h)
+{
+    for(auto const& v : qp)
+    {
+        auto const i = m.find(
+            v.decoded_key());
+        if(i != query_key_matcher::npos)
+            h(i, v);
+    }
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_QUERY_KEY_MATCHER_IPP
+#define BOOST_URL_IMPL_QUERY_KEY_MATCHER_IPP
+
+#include <boost/url/query_key_matcher.hpp>
+#include <boost/url/detail/except.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+constexpr std::size_t query_key_matcher::npos;
+
+query_key_matcher::
+query_key_matcher(
+    std::initializer_list<
+        string_view> keys)
+{
+    keys_.reserve(keys.size());
+    for(auto k : keys)
+        keys_.emplace_back(
+            k.data(), k.size());
+    build();
+}
+
+query_key_matcher::
+query_key_matcher(
+    string_view const* keys,
+    std::size_t n)
+{
+    keys_.reserve(n);
+    for(std::size_t i = 0; i < n; ++i)
+        keys_.emplace_back(
+            keys[i].data(), keys[i].size());
+    build();
+}
+
+void
+query_key_matcher::
+build()
+{
+    if(keys_.size() >= 0x7fffffff)
+        detail::throw_length_error(
+            "too many keys",
+            BOOST_CURRENT_LOCATION);
+    std::size_t max = 0;
+    for(auto const& k : keys_)
+        if(max < k.size())
+            max = k.size();
+
+    // counting sort by length, stable
+    // so equal keys keep their order
+    first_.assign(max + 2, 0);
+    for(auto const& k : keys_)
+        ++first_[k.size() + 1];
+    for(std::size_t n = 1;
+        n < first_.size(); ++n)
+        first_[n] += first_[n - 1];
+    order_.resize(keys_.size());
+    auto next = first_;
+    for(std::size_t i = 0;
+        i < keys_.size(); ++i)
+        order_[next[keys_[i].size()]++] =
+            static_cast<std::uint32_t>(i);
+}
+
+std::size_t
+query_key_matcher::
+find(pct_decoded_view key) const noexcept
+{
+    auto const n = key.size();
+    if(n + 1 >= first_.size())
+        return npos;
+    auto it = order_.data() + first_[n];
+    auto const end =
+        order_.data() + first_[n + 1];
+    if(it == end)
+        return npos;
+    if(n == 0)
+        return *it;
+    auto const s = key.encoded();
+    if(s.size() == n)
+    {
+        // no escapes
+        for(; it != end; ++it)
+            if(std::memcmp(
+                keys_[*it].data(),
+                    s.data(), n) == 0)
+                return *it;
+        return npos;
+    }
+    for(; it != end; ++it)
+        if(key == keys_[*it])
+            return *it;
+    return npos;
+}
+
+//------------------------------------------------
+
+std::size_t
+extract_query_params(
+    query_params_view qp,
+    query_key_matcher const& m,
+    query_params_view::iterator* out)
+{
+    auto const last = qp.end();
+    for(std::size_t i = 0;
+            i < m.size(); ++i)
+        out[i] = last;
+    std::size_t found = 0;
+    for(auto it = qp.begin();
+        it != last && found < m.size();
+        ++it)
+    {
+        auto const i = m.find(
+            it->decoded_key());
+        if( i == query_key_matcher::npos ||
+            out[i] != last)
+            continue;
+        out[i] = it;
+        ++found;
+    }
+    return found;
+}
+
+} // urls
+} // boost
+
+#endif
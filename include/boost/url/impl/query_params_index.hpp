@@ -0,0 +1,34 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_QUERY_PARAMS_INDEX_HPP
+#define BOOST_URL_IMPL_QUERY_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+template<class Allocator>
+string_type<Allocator>
+query_params_index::
+at( string_view key,
+    Allocator const& a) const
+{
+    auto const it = find(key);
+    if(it == end())
+        detail::throw_out_of_range(
+            BOOST_CURRENT_LOCATION);
+    return it->value(a);
+}
+
+} // urls
+} // boost
+
+#endif
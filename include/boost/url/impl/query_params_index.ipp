@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_QUERY_PARAMS_INDEX_IPP
+#define BOOST_URL_IMPL_QUERY_PARAMS_INDEX_IPP
+
+#include <boost/url/query_params_index.hpp>
+#include <boost/url/pct_decoded_view.hpp>
+#include <boost/url/rfc/pct_encoding.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/hash.hpp>
+
+namespace boost {
+namespace urls {
+
+query_params_index::
+query_params_index(
+    query_params_view qp)
+{
+    assign(qp);
+}
+
+void
+query_params_index::
+assign(query_params_view qp)
+{
+    clear();
+    if(qp.size() >= 0x7fffffff)
+        detail::throw_length_error(
+            "too many query params",
+            BOOST_CURRENT_LOCATION);
+    v_.reserve(qp.size());
+    hash_.reserve(qp.size());
+    for(auto const& e : qp)
+    {
+        v_.push_back(e);
+        // keys are hashed as their decoded
+        // characters, so a plain key and an
+        // encoded key which decodes to it
+        // land in the same slot
+        hash_.push_back(detail::hash_chars(
+            e.decoded_key()));
+    }
+
+    // power of two, at most half full
+    std::size_t n = 8;
+    while(n < 2 * v_.size())
+        n *= 2;
+    slot_.assign(n, 0);
+    pos_.resize(v_.size());
+    auto const mask = n - 1;
+    for(std::size_t i = 0;
+        i < v_.size(); ++i)
+    {
+        auto j = hash_[i] & mask;
+        while(slot_[j] != 0)
+            j = (j + 1) & mask;
+        slot_[j] = static_cast<
+            std::uint32_t>(i + 1);
+        pos_[i] = static_cast<
+            std::uint32_t>(j);
+    }
+}
+
+void
+query_params_index::
+clear() noexcept
+{
+    v_.clear();
+    hash_.clear();
+    slot_.clear();
+    pos_.clear();
+}
+
+// Return the slot of the first parameter
+// at or after `first` whose key matches
+// and hashes to `h`, searching from slot
+// `j`, or slot_.size() if there is none.
+// Parameters are inserted in order and
+// never removed, so along any probe
+// sequence the matches appear in
+// increasing index order, and the next
+// match is found by resuming one slot
+// past the previous one.
+std::size_t
+query_params_index::
+probe(
+    string_view key,
+    std::size_t h,
+    std::size_t j,
+    std::size_t first) const noexcept
+{
+    if(slot_.empty())
+        return 0;
+    auto const mask = slot_.size() - 1;
+    for(j &= mask;;
+        j = (j + 1) & mask)
+    {
+        auto const s = slot_[j];
+        if(s == 0)
+            return slot_.size();
+        auto const i = s - 1;
+        if( i < first ||
+            hash_[i] != h)
+            continue;
+        auto const& k = v_[i].k_;
+        if( k.decoded_size == key.size() &&
+            key_equal_encoded(key, k))
+            return j;
+    }
+}
+
+// Return the index of the
+// parameter in slot j, or
+// size() if j is past the end
+std::size_t
+query_params_index::
+index(std::size_t j) const noexcept
+{
+    if(j == slot_.size())
+        return v_.size();
+    return slot_[j] - 1;
+}
+
+bool
+query_params_index::
+contains(
+    string_view key) const noexcept
+{
+    auto const h =
+        detail::hash_chars(key);
+    return probe(key, h, h, 0) !=
+        slot_.size();
+}
+
+std::size_t
+query_params_index::
+count(
+    string_view key) const noexcept
+{
+    auto const h =
+        detail::hash_chars(key);
+    std::size_t n = 0;
+    for(auto j = probe(key, h, h, 0);
+        j != slot_.size();
+        j = probe(key, h, j + 1, 0))
+        ++n;
+    return n;
+}
+
+auto
+query_params_index::
+find(
+    string_view key) const noexcept ->
+        const_iterator
+{
+    auto const h =
+        detail::hash_chars(key);
+    return begin() + index(
+        probe(key, h, h, 0));
+}
+
+auto
+query_params_index::
+find(
+    const_iterator after,
+    string_view key) const noexcept ->
+        const_iterator
+{
+    if(after == end())
+        return end();
+    auto const h =
+        detail::hash_chars(key);
+    auto const i = static_cast<
+        std::size_t>(after - begin());
+    auto const& k = v_[i].k_;
+    if( hash_[i] == h &&
+        k.decoded_size == key.size() &&
+        key_equal_encoded(key, k))
+    {
+        // resume where `after` was found
+        return begin() + index(probe(
+            key, h, pos_[i] + 1, i + 1));
+    }
+    return begin() + index(
+        probe(key, h, h, i + 1));
+}
+
+std::string
+query_params_index::
+operator[](string_view key) const
+{
+    auto const it = find(key);
+    if(it == end())
+        return {};
+    return it->value();
+}
+
+} // urls
+} // boost
+
+#endif
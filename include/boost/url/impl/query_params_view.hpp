@@ -26,7 +26,11 @@ class query_params_view::iterator
     BOOST_URL_DECL
     explicit
     iterator(
-        string_view s);
+        string_view s) noexcept;
+
+    BOOST_URL_DECL
+    void
+    read(char const* p) noexcept;
 
     explicit
     iterator(
@@ -40,6 +44,7 @@ public:
         query_params_view::value_type;
     using pointer = value_type const*;
     using reference = value_type const&;
+    using difference_type = std::ptrdiff_t;
     using iterator_category =
         std::forward_iterator_tag;
 
@@ -13,8 +13,8 @@
 #include <boost/url/query_params_view.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/rfc/query_bnf.hpp>
-#include <boost/url/rfc/detail/query_params_bnf.hpp>
 #include <boost/url/detail/except.hpp>
+#include <cstring>
 
 namespace boost {
 namespace urls {
@@ -26,10 +26,15 @@ query_params_view() noexcept
 {
 }
 
+// The view is only ever made from a
+// string which was already validated,
+// so iterating only has to split on
+// '&' and '='.
+
 query_params_view::
 iterator::
 iterator(
-    string_view s)
+    string_view s) noexcept
     : next_(s.data())
     , end_(s.data() + s.size())
 {
@@ -38,19 +43,43 @@ iterator(
         next_ = nullptr;
         return;
     }
-    error_code ec;
-    query_param t;
-    detail::
-        query_params_bnf::begin(
-            next_, end_, ec, t);
-    if(ec)
-        detail::throw_system_error(
-            ec, BOOST_CURRENT_LOCATION);
-    v_.k_ = t.key;
-    if(t.value.has_value())
-        v_.v_ = *t.value;
+    read(next_);
+}
+
+void
+query_params_view::
+iterator::
+read(char const* p) noexcept
+{
+    auto amp = static_cast<char const*>(
+        std::memchr(p, '&', end_ - p));
+    if(! amp)
+        amp = end_;
+    auto const eq = static_cast<char const*>(
+        std::memchr(p, '=', amp - p));
+    if(eq)
+    {
+        v_.k_.str = string_view(p, eq - p);
+        v_.k_.decoded_size =
+            pct_decoded_size_unchecked(
+                v_.k_.str);
+        v_.v_.str = string_view(
+            eq + 1, amp - eq - 1);
+        v_.v_.decoded_size =
+            pct_decoded_size_unchecked(
+                v_.v_.str);
+        v_.has_value_ = true;
+    }
     else
+    {
+        v_.k_.str = string_view(p, amp - p);
+        v_.k_.decoded_size =
+            pct_decoded_size_unchecked(
+                v_.k_.str);
         v_.v_ = {};
+        v_.has_value_ = false;
+    }
+    next_ = amp;
 }
 
 auto
@@ -59,24 +88,13 @@ iterator::
 operator++() noexcept ->
     iterator&
 {
-    error_code ec;
-    query_param t;
-    detail::
-        query_params_bnf::increment(
-            next_, end_, ec, t);
-    if(ec == error::end)
+    if(next_ == end_)
     {
         next_ = nullptr;
         return *this;
     }
-    if(ec)
-        detail::throw_system_error(
-            ec, BOOST_CURRENT_LOCATION);
-    v_.k_ = t.key;
-    if(t.value.has_value())
-        v_.v_ = *t.value;
-    else
-        v_.v_ = {};
+    // skip '&'
+    read(next_ + 1);
     return *this;
 }
 
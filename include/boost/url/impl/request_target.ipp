@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_REQUEST_TARGET_IPP
+#define BOOST_URL_IMPL_REQUEST_TARGET_IPP
+
+#include <boost/url/request_target.hpp>
+#include <boost/url/detail/dfa.hpp>
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+url_view
+parse_request_target(
+    string_view s,
+    target_form& form,
+    error_code& ec) noexcept
+{
+    using namespace detail;
+    parts p;
+    if( ! s.empty() &&
+        s[0] == '/')
+    {
+        if(! parse_dfa(s,
+            dfa::origin_form, p, ec))
+            return {};
+        if(p.length(id_frag) != 0)
+        {
+            ec = error::syntax;
+            return {};
+        }
+        form = target_form::origin;
+        return url_view(s.data(), p);
+    }
+
+    if(s == "*")
+    {
+        for(int i = 0; i < id_end; ++i)
+            p.decoded[i] = 0;
+        for(int i = id_query; i <= id_end; ++i)
+            p.offset[i] = 1;
+        p.decoded[id_path] = 1;
+        p.nseg = 1;
+        ec = {};
+        form = target_form::asterisk;
+        return url_view(s.data(), p);
+    }
+
+    bool const is_uri = parse_dfa(
+        s, dfa::uri, p, ec);
+    if(is_uri)
+    {
+        if(p.length(id_frag) != 0)
+        {
+            ec = error::syntax;
+            return {};
+        }
+        // host ":" port is also an
+        // absolute-URI with this shape
+        bool digits = true;
+        for(auto c : p.get(id_path, s.data()))
+            if(c < '0' || c > '9')
+            {
+                digits = false;
+                break;
+            }
+        if( ! digits ||
+            p.length(id_user) != 0 ||
+            p.length(id_query) != 0)
+        {
+            form = target_form::absolute;
+            return url_view(s.data(), p);
+        }
+    }
+
+    parts pa;
+    error_code ec1;
+    if( parse_dfa(s, dfa::authority_form,
+            pa, ec1) &&
+        pa.length(id_port) != 0 &&
+        pa.offset[id_path] == s.size())
+    {
+        ec = {};
+        form = target_form::authority;
+        return url_view(s.data(), pa);
+    }
+    if(is_uri)
+    {
+        form = target_form::absolute;
+        return url_view(s.data(), p);
+    }
+    return {};
+}
+
+url_view
+parse_request_target(
+    string_view s,
+    target_form& form)
+{
+    error_code ec;
+    auto u = parse_request_target(
+        s, form, ec);
+    detail::maybe_throw(ec,
+        BOOST_CURRENT_LOCATION);
+    return u;
+}
+
+} // urls
+} // boost
+
+#endif
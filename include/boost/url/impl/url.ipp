@@ -12,6 +12,9 @@
 
 #include <boost/url/error.hpp>
 #include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/dfa.hpp>
+#include <boost/url/detail/except.hpp>
 #include <boost/url/detail/parse.hpp>
 #include <cstring>
 #include <stdexcept>
@@ -20,6 +23,19 @@
 namespace boost {
 namespace urls {
 
+// Throw the exception which the modifiers
+// without an error_code report for ec
+static
+void
+raise_on_error(error_code const& ec)
+{
+    if(! ec)
+        return;
+    if(ec == error::capacity_exceeded)
+        too_large::raise();
+    invalid_part::raise();
+}
+
 string_view
 url::
 get(int id) const noexcept
@@ -49,6 +65,29 @@ len(int id0, int id1) const noexcept
     return pt_.length(id0, id1);
 }
 
+std::size_t
+url::
+decoded_size(int id) const noexcept
+{
+    auto const n = pt_.decoded[id];
+    if(n != detail::parts::unknown)
+        return n;
+    string_view s;
+    switch(id)
+    {
+    case id_user: s = encoded_username(); break;
+    case id_pass: s = encoded_password(); break;
+    case id_host: s = encoded_host(); break;
+    case id_path: s = encoded_path(); break;
+    case id_query: s = encoded_query(); break;
+    case id_frag: s = encoded_fragment(); break;
+    default:
+        BOOST_ASSERT(false);
+        break;
+    }
+    return pct_decoded_size_unchecked(s);
+}
+
 //------------------------------------------------
 
 #if 0
@@ -99,6 +138,24 @@ encoded_url() const
     return get(id_scheme, id_end);
 }
 
+url::
+operator url_view() const noexcept
+{
+    // setters leave some decoded
+    // sizes unknown, but views
+    // expect all of them
+    auto pt = pt_;
+    for(int id = id_user;
+        id < id_end; ++id)
+    {
+        if(id == id_port)
+            continue;
+        pt.decoded[id] =
+            decoded_size(id);
+    }
+    return url_view(s_ ? s_ : "", pt);
+}
+
 string_view
 url::
 encoded_origin() const noexcept
@@ -473,7 +530,7 @@ encoded_fragment() const noexcept
 url::
 ~url()
 {
-    if(s_)
+    if(s_ && s_ != ibuf_)
     {
         BOOST_ASSERT(cap_ != 0);
         sp_->deallocate(s_, cap_ + 1, 1);
@@ -483,6 +540,87 @@ url::
 url::
 url() noexcept = default;
 
+url::
+url(url const& u)
+    : sp_(u.sp_)
+{
+    assign_impl(
+        u.encoded_url(), u.pt_);
+}
+
+url::
+url(url&& u) noexcept
+    : sp_(u.sp_)
+{
+    if(u.s_ && u.s_ != u.ibuf_)
+    {
+        s_ = u.s_;
+        cap_ = u.cap_;
+        pt_ = u.pt_;
+        u.reset_impl();
+        return;
+    }
+    assign_impl(
+        u.encoded_url(), u.pt_);
+    u.clear();
+}
+
+url&
+url::
+operator=(url const& u)
+{
+    if(this != &u)
+        assign_impl(
+            u.encoded_url(), u.pt_);
+    return *this;
+}
+
+url&
+url::
+operator=(url&& u)
+{
+    if(this == &u)
+        return *this;
+    if( ! fixed_ &&
+        u.s_ && u.s_ != u.ibuf_ &&
+        sp_->is_equal(*u.sp_))
+    {
+        if(s_ && s_ != ibuf_)
+            sp_->deallocate(s_, cap_ + 1, 1);
+        s_ = u.s_;
+        cap_ = u.cap_;
+        pt_ = u.pt_;
+        u.reset_impl();
+        return *this;
+    }
+    assign_impl(
+        u.encoded_url(), u.pt_);
+    return *this;
+}
+
+url::
+url(
+    char* buf,
+    std::size_t cap,
+    storage_ptr sp) noexcept
+    : s_(buf)
+    , sp_(std::move(sp))
+    , cap_(cap)
+    , ibuf_(buf)
+    , icap_(cap)
+{
+    s_[0] = '\0';
+}
+
+url::
+url(
+    char* buf,
+    std::size_t cap) noexcept
+    : url(buf, cap, storage_ptr())
+{
+    fixed_ = true;
+}
+
 url::
 url(
     storage_ptr sp,
@@ -518,57 +656,146 @@ url::
 set_encoded_url(
     string_view s)
 {
+    error_code ec;
+    set_encoded_url(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_url(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         clear();
         return *this;
     }
 
-    error_code ec;
-    detail::parser pr(s);
     detail::parts pt;
     detail::parse_url(pt, s, ec);
     if(ec)
+        return *this;
+    if( fixed_ &&
+        s.size() > cap_)
+    {
+        ec = error::capacity_exceeded;
+        return *this;
+    }
+    assign_impl(s, pt);
+    return *this;
+}
+
+url&
+url::
+assign(url_view const& v)
+{
+    // a url keeps its authority after "//",
+    // which an authority-form view lacks
+    if( v.pt_.length(id_user) == 0 &&
+        v.pt_.length(
+            id_pass, id_path) != 0)
         invalid_part::raise();
+    assign_impl(
+        v.encoded_url(), v.pt_);
+    return *this;
+}
 
-    auto p = static_cast<char*>(
-        sp_->allocate(s.size() + 1, 1));
-    if(s_)
+void
+url::
+reserve(std::size_t n)
+{
+    if(n > cap_)
+        reserve_impl(n);
+}
+
+void
+url::
+shrink_to_fit()
+{
+    if( cap_ == size() ||
+        s_ == ibuf_)
+        return;
+    auto const n = size();
+    if(ibuf_ && n <= icap_)
+    {
+        // back to the inline buffer
+        std::memcpy(ibuf_, s_, n + 1);
+        sp_->deallocate(s_, cap_ + 1, 1);
+        s_ = ibuf_;
+        cap_ = icap_;
+        return;
+    }
+    if(n == 0)
+    {
         sp_->deallocate(s_, cap_ + 1, 1);
+        s_ = nullptr;
+        cap_ = 0;
+        pt_.clear();
+        return;
+    }
+    auto p = static_cast<char*>(
+        sp_->allocate(n + 1, 1));
+    std::memcpy(p, s_, n + 1);
+    sp_->deallocate(s_, cap_ + 1, 1);
     s_ = p;
-    s_[s.size()] = '\0';
-    cap_ = s.size();
+    cap_ = n;
+}
 
-    //---
-    pt_ = pt;
-    std::memcpy(
-        s_, s.data(), s.size());
+url&
+url::
+set_encoded_origin(
+    string_view s)
+{
+    error_code ec;
+    set_encoded_origin(s, ec);
+    raise_on_error(ec);
     return *this;
 }
 
 url&
 url::
 set_encoded_origin(
-    string_view s)
+    string_view s,
+    error_code& ec)
 {
+    ec = {};
     if(s.empty())
     {
         resize_impl(
             id_scheme,
-            id_path, 0);
+            id_path, 0, ec);
         return *this;
     }
 
-    error_code ec;
     detail::parts pt;
     detail::parse_origin(pt, s, ec);
     if(ec)
-        invalid_part::raise();
+        return *this;
+    // only a root path may follow
+    // the origin, and it is dropped
+    {
+        auto const rest = s.substr(
+            pt.offset[id_path]);
+        if( ! rest.empty() &&
+            rest != "/")
+        {
+            ec = error::invalid;
+            return *this;
+        }
+    }
+    s = s.substr(0,
+        pt.offset[id_path]);
     auto const dest =
         resize_impl(
             id_scheme,
             id_path,
-            s.size());
+            s.size(), ec);
+    if(ec)
+        return *this;
     s.copy(dest, s.size());
     pt_.split(
         id_scheme,
@@ -598,17 +825,34 @@ url::
 set_scheme(
     string_view s)
 {
+    error_code ec;
+    set_scheme(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_scheme(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
-        resize_impl(id_scheme, 0);
+        resize_impl(id_scheme, 0, ec);
         return *this;
     }
 
     detail::parts pr;
-    detail::parse_scheme(pr, s);
+    detail::parse_scheme(pr, s, ec);
+    if(ec)
+        return *this;
     auto const n = s.size();
     auto const dest =
-        resize_impl(id_scheme, n + 1);
+        resize_impl(id_scheme, n + 1, ec);
+    if(ec)
+        return *this;
     s.copy(dest, n);
     dest[n] = ':';
     return *this;
@@ -625,27 +869,44 @@ url::
 set_encoded_authority(
     string_view s)
 {
+    error_code ec;
+    set_encoded_authority(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_authority(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         resize_impl(
             id_user,
-            id_path, 0);
+            id_path, 0, ec);
         return *this;
     }
 
     detail::parts pt;
-    detail::parse_authority(pt, s);
+    detail::parse_authority(pt, s, ec);
+    if(ec)
+        return *this;
     auto const dest = resize_impl(
         id_user,
         id_path,
-        2 + s.size());
+        2 + s.size(), ec);
+    if(ec)
+        return *this;
     //---
     dest[0] = '/';
     dest[1] = '/';
     s.copy(dest + 2, s.size());
     pt_.split(
         id_user,
-        2 + pt.length(id_user));
+        pt.length(id_user));
     pt_.split(
         id_pass,
         pt.length(id_pass));
@@ -669,6 +930,19 @@ url::
 set_encoded_userinfo(
     string_view s)
 {
+    error_code ec;
+    set_encoded_userinfo(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_userinfo(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         if(pt_.length(
@@ -678,22 +952,26 @@ set_encoded_userinfo(
             // no authority
             resize_impl(
                 id_user,
-                id_host, 0);
+                id_host, 0, ec);
             return *this;
         }
         // keep "//"
         resize_impl(
             id_user,
-            id_host, 2);
+            id_host, 2, ec);
         return *this;
     }
 
     detail::parts pt;
-    detail::parse_userinfo(pt, s);
+    detail::parse_userinfo(pt, s, ec);
+    if(ec)
+        return *this;
     auto dest = resize_impl(
         id_user,
         id_host,
-        2 + s.size() + 1);
+        2 + s.size() + 1, ec);
+    if(ec)
+        return *this;
     dest[0] = '/';
     dest[1] = '/';
     dest += 2;
@@ -709,14 +987,29 @@ url&
 url::
 set_userinfo_part(
     string_view s)
+{
+    error_code ec;
+    set_userinfo_part(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_userinfo_part(
+    string_view s,
+    error_code& ec)
 {
     if(! s.empty())
     {
         if(s.back() != '@')
-            invalid_part::raise();
+        {
+            ec = error::invalid;
+            return *this;
+        }
         s.remove_suffix(1);
     }
-    return set_encoded_userinfo(s);
+    return set_encoded_userinfo(s, ec);
 }
 
 url&
@@ -724,6 +1017,19 @@ url::
 set_user(
     string_view s)
 {
+    error_code ec;
+    set_user(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_user(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         if(pt_.length(
@@ -743,11 +1049,11 @@ set_user(
             // remove '@'
             resize_impl(
                 id_user,
-                id_host, 2);
+                id_host, 2, ec);
         }
         else
         {
-            resize_impl(id_user, 2);
+            resize_impl(id_user, 2, ec);
         }
         return *this;
     }
@@ -760,22 +1066,28 @@ set_user(
         BOOST_ASSERT(pt_.get(
             id_pass, s_).back() == '@');
         // preserve "//"
+        auto const n = e.encoded_size(s);
         auto const dest = resize_impl(
-            id_user,
-            2 + e.encoded_size(s));
-        e.encode(dest + 2, s);
+            id_user, 2 + n, ec);
+        if(ec)
+            return *this;
+        e.encode(dest + 2, dest + 2 + n, s);
+        pt_.decoded[id_user] = s.size();
         return *this;
     }
     auto const n = e.encoded_size(s);
     auto const dest = resize_impl(
-        id_user, 2 + n + 1);
+        id_user, 2 + n + 1, ec);
+    if(ec)
+        return *this;
     dest[0] = '/';
     dest[1] = '/';
     dest[2 + n] = '@';
     pt_.split(
         id_user,
         2 + n);
-    e.encode(dest + 2, s);
+    e.encode(dest + 2, dest + 2 + n, s);
+    pt_.decoded[id_user] = s.size();
     return *this;
 }
 
@@ -783,13 +1095,30 @@ url&
 url::
 set_encoded_user(
     string_view s)
+{
+    error_code ec;
+    set_encoded_user(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_user(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
-        return set_user(s);
+        return set_user(s, ec);
 
+    ec = {};
     auto const e =
         detail::userinfo_nc_pct_set();
-    e.validate(s);
+    if(! e.check(s))
+    {
+        ec = error::invalid;
+        return *this;
+    }
 
     auto const n = s.size();
     if(pt_.length(id_pass) != 0)
@@ -798,7 +1127,9 @@ set_encoded_user(
             id_pass, s_).back() == '@');
         // preserve "//"
         auto const dest = resize_impl(
-            id_user, 2 + n);
+            id_user, 2 + n, ec);
+        if(ec)
+            return *this;
         s.copy(dest + 2, n);
         return *this;
     }
@@ -806,7 +1137,9 @@ set_encoded_user(
     // add '@'
     auto const dest = resize_impl(
         id_user,
-        2 + n + 1);
+        2 + n + 1, ec);
+    if(ec)
+        return *this;
     dest[0] = '/';
     dest[1] = '/';
     dest[2 + n] = '@';
@@ -822,6 +1155,19 @@ url::
 set_password(
     string_view s)
 {
+    error_code ec;
+    set_password(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_password(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         auto const n = pt_.length(
@@ -839,11 +1185,11 @@ set_password(
         if(pt_.length(id_user) == 2)
         {
             // remove '@'
-            resize_impl(id_pass, 0);
+            resize_impl(id_pass, 0, ec);
             return *this;
         }
         // retain '@'
-        *resize_impl(id_pass, 1) = '@';
+        *resize_impl(id_pass, 1, ec) = '@';
         return *this;
     }
 
@@ -854,22 +1200,29 @@ set_password(
     if(pt_.length(id_user) != 0)
     {
         auto const dest = resize_impl(
-            id_pass, 1 + n + 1);
+            id_pass, 1 + n + 1, ec);
+        if(ec)
+            return *this;
         dest[0] = ':';
         dest[n + 1] = '@';
-        e.encode(dest + 1, s);
+        e.encode(dest + 1, dest + 1 + n, s);
+        pt_.decoded[id_pass] = s.size();
         return *this;
     }
     auto const dest = resize_impl(
         id_user,
         id_host,
-        2 + 1 + n + 1);
+        2 + 1 + n + 1, ec);
+    if(ec)
+        return *this;
     dest[0] = '/';
     dest[1] = '/';
     dest[2] = ':';
     dest[2 + n + 1] = '@';
-    e.encode(dest + 3, s);
+    e.encode(dest + 3, dest + 3 + n, s);
     pt_.split(id_user, 2);
+    pt_.decoded[id_user] = 0;
+    pt_.decoded[id_pass] = s.size();
     return *this;
 }
 
@@ -877,21 +1230,39 @@ url&
 url::
 set_encoded_password(
     string_view s)
+{
+    error_code ec;
+    set_encoded_password(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_password(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
-        return set_password(s);
+        return set_password(s, ec);
 
+    ec = {};
     auto const e =
         detail::userinfo_pct_set();
-    if(s[0] == ':')
-        invalid_part::raise();
-    e.validate(s);
+    if( s[0] == ':' ||
+        ! e.check(s))
+    {
+        ec = error::invalid;
+        return *this;
+    }
 
     auto const n = s.size();
     if(pt_.length(id_user) != 0)
     {
         auto const dest = resize_impl(
-            id_pass, 1 + n + 1);
+            id_pass, 1 + n + 1, ec);
+        if(ec)
+            return *this;
         dest[0] = ':';
         dest[n + 1] = '@';
         s.copy(dest + 1, n);
@@ -900,7 +1271,9 @@ set_encoded_password(
     auto const dest = resize_impl(
         id_user,
         id_host,
-        2 + 1 + n + 1);
+        2 + 1 + n + 1, ec);
+    if(ec)
+        return *this;
     dest[0] = '/';
     dest[1] = '/';
     dest[2] = ':';
@@ -914,25 +1287,45 @@ url&
 url::
 set_password_part(
     string_view s)
+{
+    error_code ec;
+    set_password_part(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_password_part(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
-        return set_password(s);
+        return set_password(s, ec);
+    ec = {};
     if(s.size() == 1)
     {
         if(s.front() != ':')
-            invalid_part::raise();
+        {
+            ec = error::invalid;
+            return *this;
+        }
         if(pt_.length(
             id_user) != 0)
         {
             auto const dest = resize_impl(
-                id_pass, 2);
+                id_pass, 2, ec);
+            if(ec)
+                return *this;
             dest[0] = ':';
             dest[1] = '@';
             return *this;
         }
         auto const dest = resize_impl(
             id_user,
-            id_host, 4);
+            id_host, 4, ec);
+        if(ec)
+            return *this;
         dest[0] = '/';
         dest[1] = '/';
         dest[2] = ':';
@@ -940,9 +1333,8 @@ set_password_part(
         pt_.split(
             id_user, 2);
     }
-    set_encoded_password(
-        s.substr(1));
-    return *this;
+    return set_encoded_password(
+        s.substr(1), ec);
 }
 
 //------------------------------------------------
@@ -956,6 +1348,19 @@ url::
 set_host(
     string_view s)
 {
+    error_code ec;
+    set_host(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_host(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         // just hostname
@@ -970,11 +1375,11 @@ set_host(
             // remove authority
             resize_impl(
                 id_user,
-                id_path, 0);
+                id_path, 0, ec);
         }
         else
         {
-            resize_impl(id_host, 0);
+            resize_impl(id_host, 0, ec);
         }
         return *this;
     }
@@ -989,7 +1394,9 @@ set_host(
             // add authority
             auto const dest = resize_impl(
                 id_user,
-                2 + s.size());
+                2 + s.size(), ec);
+            if(ec)
+                return *this;
             dest[0] = '/';
             dest[1] = '/';
             pt_.split(
@@ -1002,7 +1409,9 @@ set_host(
         {
             auto const dest = resize_impl(
                 id_host,
-                s.size());
+                s.size(), ec);
+            if(ec)
+                return *this;
             s.copy(dest, s.size());
         }
     }
@@ -1013,26 +1422,31 @@ set_host(
         if(! has_authority())
         {
             // add authority
+            auto const n = e.encoded_size(s);
             auto const dest = resize_impl(
-                id_user,
-                2 + e.encoded_size(s));
+                id_user, 2 + n, ec);
+            if(ec)
+                return *this;
             dest[0] = '/';
             dest[1] = '/';
             pt_.split(
                 id_user, 2);
             pt_.split(
                 id_pass, 0);
-            e.encode(dest + 2, s);
+            e.encode(dest + 2, dest + 2 + n, s);
         }
         else
         {
+            auto const n = e.encoded_size(s);
             auto const dest = resize_impl(
-                id_host,
-                e.encoded_size(s));
-            e.encode(dest, s);
+                id_host, n, ec);
+            if(ec)
+                return *this;
+            e.encode(dest, dest + n, s);
         }
     }
     pt_.host_type = pt.host_type;
+    pt_.decoded[id_host] = s.size();
     return *this;
 }
 
@@ -1040,17 +1454,34 @@ url&
 url::
 set_encoded_host(
     string_view s)
+{
+    error_code ec;
+    set_encoded_host(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_host(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
-        return set_host(s);
+        return set_host(s, ec);
+    ec = {};
     detail::parts pt;
-    detail::parse_hostname(pt, s);
-    if(! has_authority())
+    detail::parse_hostname(pt, s, ec);
+    if(ec)
+        return *this;
+    if(! has_authority())
     {
         // add authority
         auto const dest = resize_impl(
             id_user,
-            2 + s.size());
+            2 + s.size(), ec);
+        if(ec)
+            return *this;
         dest[0] = '/';
         dest[1] = '/';
         pt_.split(
@@ -1063,10 +1494,14 @@ set_encoded_host(
     {
         auto const dest = resize_impl(
             id_host,
-            s.size());
+            s.size(), ec);
+        if(ec)
+            return *this;
         s.copy(dest, s.size());
     }
     pt_.host_type = pt.host_type;
+    pt_.decoded[id_host] =
+        pt.decoded[id_host];
     return *this;
 }
 
@@ -1078,10 +1513,33 @@ set_port(unsigned n)
     return set_port(s.get());
 }
 
+url&
+url::
+set_port(
+    unsigned n,
+    error_code& ec)
+{
+    detail::port_string s(n);
+    return set_port(s.get(), ec);
+}
+
 url&
 url::
 set_port(string_view s)
 {
+    error_code ec;
+    set_port(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_port(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
         // just port
@@ -1095,21 +1553,25 @@ set_port(string_view s)
                     0, 2) == "//");
             resize_impl(
                 id_user,
-                id_path, 0);
+                id_path, 0, ec);
         }
         else
         {
-            resize_impl(id_port, 0);
+            resize_impl(id_port, 0, ec);
         }
         return *this;
     }
-    detail::match_port(s);
+    detail::match_port(s, ec);
+    if(ec)
+        return *this;
     if(! has_authority())
     {
         // add authority
         auto const dest = resize_impl(
             id_user,
-            3 + s.size());
+            3 + s.size(), ec);
+        if(ec)
+            return *this;
         dest[0] = '/';
         dest[1] = '/';
         dest[2] = ':';
@@ -1125,7 +1587,9 @@ set_port(string_view s)
     {
         auto const dest = resize_impl(
             id_port,
-            1 + s.size());
+            1 + s.size(), ec);
+        if(ec)
+            return *this;
         dest[0] = ':';
         s.copy(dest + 1, s.size());
     }
@@ -1135,18 +1599,34 @@ set_port(string_view s)
 url&
 url::
 set_port_part(string_view s)
+{
+    error_code ec;
+    set_port_part(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_port_part(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
+        return set_port(s, ec);
+    ec = {};
+    if(s.front() != ':')
     {
-        set_port(s);
+        ec = error::invalid;
         return *this;
     }
-    if(s.front() != ':')
-        invalid_part::raise();
     if(s.size() > 1)
-        return set_port(s.substr(1));
-    resize_impl(
-        id_port, 1)[0] = ':';
+        return set_port(s.substr(1), ec);
+    auto const dest = resize_impl(
+        id_port, 1, ec);
+    if(ec)
+        return *this;
+    dest[0] = ':';
     return *this;
 }
 
@@ -1156,42 +1636,134 @@ set_port_part(string_view s)
 //
 //------------------------------------------------
 
+url&
+url::
+set_path(
+    string_view s)
+{
+    error_code ec;
+    set_path(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_path(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
+    if(s.empty())
+    {
+        resize_impl(
+            id_path, 0, ec);
+        pt_.nseg = 0;
+        return *this;
+    }
+    if(has_authority())
+    {
+        // path-abempty
+        if(s.front() != '/')
+        {
+            ec = error::invalid;
+            return *this;
+        }
+    }
+    else if(s.starts_with("//"))
+    {
+        // would be an authority
+        ec = error::invalid;
+        return *this;
+    }
+    auto const e =
+        detail::path_pct_set();
+    // path-noscheme, where
+    // the first segment has
+    // its colons escaped
+    string_view s0;
+    if( s.front() != '/' &&
+        pt_.length(id_scheme) == 0)
+    {
+        auto const n = s.find('/');
+        s0 = s.substr(0, n);
+        s.remove_prefix(s0.size());
+    }
+    auto const e0 =
+        detail::pchar_nc_pct_set();
+    auto const n0 =
+        e0.encoded_size(s0);
+    auto const n =
+        e.encoded_size(s);
+    auto const dest = resize_impl(
+        id_path, n0 + n, ec);
+    if(ec)
+        return *this;
+    e0.encode(dest, dest + n0, s0);
+    e.encode(dest + n0,
+        dest + n0 + n, s);
+    pt_.decoded[id_path] =
+        s0.size() + s.size();
+    pt_.nseg = detail::path_segments(
+        get(id_path));
+    return *this;
+}
+
 url&
 url::
 set_encoded_path(
     string_view s)
 {
+    error_code ec;
+    set_encoded_path(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_path(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     // path-empty
     if(s.empty())
     {
         resize_impl(
-            id_path, 0);
+            id_path, 0, ec);
+        pt_.nseg = 0;
         return *this;
     }
     if(has_authority())
     {
         // path-abempty
-        detail::match_path_abempty(s);
+        detail::match_path_abempty(s, ec);
     }
     else if(s.front() == '/')
     {
         // path-absolute
-        detail::match_path_absolute(s);
+        detail::match_path_absolute(s, ec);
     }
     else if(pt_.length(
         id_scheme) == 0)
     {
         // path-noscheme
-        detail::match_path_noscheme(s);
+        detail::match_path_noscheme(s, ec);
     }
     else
     {
         // path-rootless
-        detail::match_path_rootless(s);
+        detail::match_path_rootless(s, ec);
     }
+    if(ec)
+        return *this;
     auto const dest = resize_impl(
-        id_path, s.size());
+        id_path, s.size(), ec);
+    if(ec)
+        return *this;
     s.copy(dest, s.size());
+    pt_.nseg = detail::path_segments(s);
     return *this;
 }
 
@@ -1214,9 +1786,23 @@ url::
 set_query(
     string_view s)
 {
+    error_code ec;
+    set_query(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_query(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
-        resize_impl(id_query, 0);
+        resize_impl(id_query, 0, ec);
+        pt_.nparam = 0;
         return *this;
     }
     auto const e =
@@ -1225,9 +1811,14 @@ set_query(
         e.encoded_size(s);
     auto const dest = resize_impl(
         id_query,
-        1 + n);
+        1 + n, ec);
+    if(ec)
+        return *this;
     dest[0] = '?';
-    e.encode(dest + 1, s);
+    e.encode(dest + 1, dest + 1 + n, s);
+    pt_.decoded[id_query] = s.size();
+    pt_.nparam = detail::query_params_count(
+        string_view(dest + 1, n));
     return *this;
 }
 
@@ -1236,19 +1827,41 @@ url::
 set_encoded_query(
     string_view s)
 {
+    error_code ec;
+    set_encoded_query(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_query(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
-        resize_impl(id_query, 0);
+        resize_impl(id_query, 0, ec);
+        pt_.nparam = 0;
         return *this;
     }
     auto const e =
         detail::query_pct_set();
-    e.validate(s);
+    if(! e.check(s))
+    {
+        ec = error::invalid;
+        return *this;
+    }
     auto const dest = resize_impl(
         id_query,
-        1 + s.size());
+        1 + s.size(), ec);
+    if(ec)
+        return *this;
     dest[0] = '?';
     s.copy(dest + 1, s.size());
+    pt_.nparam = detail::query_params_count(
+        string_view(dest + 1, s.size()));
     return *this;
 }
 
@@ -1256,24 +1869,40 @@ url&
 url::
 set_query_part(
     string_view s)
+{
+    error_code ec;
+    set_query_part(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_query_part(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
+        return set_encoded_query(s, ec);
+    if(s.front() != '?')
     {
-        resize_impl(id_query, 0);
+        ec = error::invalid;
         return *this;
     }
-    if(s.front() != '?')
-        invalid_part::raise();
     s = s.substr(1);
-    auto const e =
-        detail::query_pct_set();
-    e.validate(s);
-    auto const dest = resize_impl(
-        id_query,
-        1 + s.size());
-    dest[0] = '?';
-    s.copy(dest + 1, s.size());
-    return *this;
+    if(s.empty())
+    {
+        // keep the '?'
+        ec = {};
+        auto const dest = resize_impl(
+            id_query, 1, ec);
+        if(ec)
+            return *this;
+        dest[0] = '?';
+        pt_.nparam = 1;
+        return *this;
+    }
+    return set_encoded_query(s, ec);
 }
 
 auto
@@ -1295,9 +1924,22 @@ url::
 set_fragment(
     string_view s)
 {
+    error_code ec;
+    set_fragment(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_fragment(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
-        resize_impl(id_frag, 0);
+        resize_impl(id_frag, 0, ec);
         return *this;
     }
     auto const e =
@@ -1305,9 +1947,12 @@ set_fragment(
     auto const n =
         e.encoded_size(s);
     auto const dest = resize_impl(
-        id_frag, 1 + n);
+        id_frag, 1 + n, ec);
+    if(ec)
+        return *this;
     dest[0] = '#';
-    e.encode(dest + 1, s);
+    e.encode(dest + 1, dest + 1 + n, s);
+    pt_.decoded[id_frag] = s.size();
     return *this;
 }
 
@@ -1316,17 +1961,36 @@ url::
 set_encoded_fragment(
     string_view s)
 {
+    error_code ec;
+    set_encoded_fragment(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_encoded_fragment(
+    string_view s,
+    error_code& ec)
+{
+    ec = {};
     if(s.empty())
     {
-        resize_impl(id_frag, 0);
+        resize_impl(id_frag, 0, ec);
         return *this;
     }
     auto const e =
         detail::frag_pct_set();
-    e.validate(s);
+    if(! e.check(s))
+    {
+        ec = error::invalid;
+        return *this;
+    }
     auto const dest = resize_impl(
         id_frag,
-        1 + s.size());
+        1 + s.size(), ec);
+    if(ec)
+        return *this;
     dest[0] = '#';
     s.copy(dest + 1, s.size());
     return *this;
@@ -1336,24 +2000,39 @@ url&
 url::
 set_fragment_part(
     string_view s)
+{
+    error_code ec;
+    set_fragment_part(s, ec);
+    raise_on_error(ec);
+    return *this;
+}
+
+url&
+url::
+set_fragment_part(
+    string_view s,
+    error_code& ec)
 {
     if(s.empty())
+        return set_encoded_fragment(s, ec);
+    if(s.front() != '#')
     {
-        resize_impl(id_frag, 0);
+        ec = error::invalid;
         return *this;
     }
-    if(s.front() != '#')
-        invalid_part::raise();
     s = s.substr(1);
-    auto const e =
-        detail::frag_pct_set();
-    e.validate(s);
-    auto const dest = resize_impl(
-        id_frag,
-        1 + s.size());
-    dest[0] = '#';
-    s.copy(dest + 1, s.size());
-    return *this;
+    if(s.empty())
+    {
+        // keep the '#'
+        ec = {};
+        auto const dest = resize_impl(
+            id_frag, 1, ec);
+        if(ec)
+            return *this;
+        dest[0] = '#';
+        return *this;
+    }
+    return set_encoded_fragment(s, ec);
 }
 
 //------------------------------------------------
@@ -1417,6 +2096,7 @@ iterator() noexcept
     : v_(nullptr)
     , off_(0)
     , n_(0)
+    , dn_(0)
 {
 }
 
@@ -1432,6 +2112,7 @@ iterator(
     {
         off_ = 0;
         n_ = 0;
+        dn_ = 0;
     }
     else if( end ||
         v_->pt_.nseg == 0)
@@ -1439,6 +2120,7 @@ iterator(
         off_ = v_->pt_.offset[
             id_query];
         n_ = 0;
+        dn_ = 0;
     }
     else
     {
@@ -1460,7 +2142,7 @@ operator*() const noexcept ->
     if(! s.empty() &&
         s.front() == '/')
         s = s.substr(1);
-    return value_type(s);
+    return value_type(s, dn_);
 }
 
 auto
@@ -1479,6 +2161,7 @@ operator++() noexcept ->
     {
         // end
         n_ = 0;
+        dn_ = 0;
     }
     else
     {
@@ -1512,9 +2195,8 @@ operator--() noexcept ->
     }
     // fails for relative-uri
     //BOOST_ASSERT(*p == '/');
-    auto const off = p - v_->s_;
-    n_ = off_ - off;
-    off_ = off;
+    off_ = p - v_->s_;
+    parse();
     return *this;
 }
 
@@ -1535,13 +2217,17 @@ parse() noexcept
     auto p = p0;
     if(*p == '/')
         ++p;
+    auto const p1 = p;
+    std::size_t npct = 0;
     while(p < end)
     {
         if(*p == '/')
             break;
+        npct += (*p == '%');
         ++p;
     }
     n_ = p - p0;
+    dn_ = (p - p1) - 2 * npct;
 }
 
 //------------------------------------------------
@@ -1564,6 +2250,26 @@ end() const noexcept ->
     return iterator(v_, true);
 }
 
+auto
+url::
+segments_type::
+front() const noexcept ->
+    value_type
+{
+    BOOST_ASSERT(! empty());
+    return *begin();
+}
+
+auto
+url::
+segments_type::
+back() const noexcept ->
+    value_type
+{
+    BOOST_ASSERT(! empty());
+    return *--end();
+}
+
 auto
 url::
 segments_type::
@@ -1601,6 +2307,8 @@ erase( iterator first, iterator last ) noexcept ->
     v.pt_.resize(
         id_path,
         v.pt_.length(id_path, id_query) - d);
+    v.pt_.decoded[id_path] =
+        detail::parts::unknown;
     BOOST_ASSERT(v.s_[v.pt_.offset[id_end]] == '\0');
     first.parse();
     return first;
@@ -1609,8 +2317,11 @@ erase( iterator first, iterator last ) noexcept ->
 auto
 url::
 segments_type::
-insert_encoded_impl( iterator pos, string_view s ) ->
-    iterator
+insert_encoded_impl(
+    iterator pos,
+    string_view s,
+    error_code& ec) ->
+        iterator
 {
     pos.check(v_);
     BOOST_ASSERT(detail::pchar_pct_set().check(s));
@@ -1621,8 +2332,11 @@ insert_encoded_impl( iterator pos, string_view s ) ->
     BOOST_ASSERT(pos.off_ <= v.pt_.offset[id_query]);
     auto const n0 = v.pt_.offset[id_end];
     auto const n = s.size() + 1;
-    v.resize_impl(v.size() + n);
+    v.resize_impl(v.size() + n, ec);
+    if(ec)
+        return pos;
     v.pt_.resize(id_path, v.pt_.length(id_path, id_query) + n);
+    v.pt_.decoded[id_path] = detail::parts::unknown;
     std::memmove(v.s_ + v.pt_.offset[id_end] + pos.off_ - n0, v.s_ + pos.off_, n0 - pos.off_ + 1);
     BOOST_ASSERT(v.s_[v.pt_.offset[id_end]] == '\0');
     v.s_[pos.off_] = '/';
@@ -1636,8 +2350,12 @@ insert_encoded_impl( iterator pos, string_view s ) ->
 auto
 url::
 segments_type::
-insert_impl( iterator pos, string_view s, std::size_t const ns ) ->
-    iterator
+insert_impl(
+    iterator pos,
+    string_view s,
+    std::size_t const ns,
+    error_code& ec) ->
+        iterator
 {
     BOOST_ASSERT(v_ != nullptr);
     url& v = *v_;
@@ -1648,25 +2366,75 @@ insert_impl( iterator pos, string_view s, std::size_t const ns ) ->
     BOOST_ASSERT(pct.encoded_size(s) == ns);
     auto const n0 = v.pt_.offset[id_end];
     auto const n = ns + 1;
-    v.resize_impl(v.size() + n);
+    v.resize_impl(v.size() + n, ec);
+    if(ec)
+        return pos;
     v.pt_.resize(id_path, v.pt_.length(id_path, id_query) + n);
+    v.pt_.decoded[id_path] = detail::parts::unknown;
     std::memmove(v.s_ + v.pt_.offset[id_end] + pos.off_ - n0, v.s_ + pos.off_, n0 - pos.off_ + 1);
     BOOST_ASSERT(v.s_[v.pt_.offset[id_end]] == '\0');
     v.s_[pos.off_] = '/';
-    pct.encode(v.s_ + pos.off_ + 1, s);
+    pct.encode(v.s_ + pos.off_ + 1,
+        v.s_ + pos.off_ + n, s);
     ++v.pt_.nseg;
     pos.off_ += n;
     pos.parse();
     return pos;
 }
 
+// Make room to replace the segment at
+// pos with one of n encoded characters,
+// so that the erase and insert which
+// follow can't fail between them
+void
+url::
+segments_type::
+reserve_replace(
+    iterator pos,
+    std::size_t n,
+    error_code& ec)
+{
+    url& v = *v_;
+    auto last = pos;
+    ++last;
+    auto const d =
+        last.off_ - pos.off_;
+    auto const need =
+        v.size() - d + n + 1;
+    if(need > v.cap_)
+        v.reserve_impl(
+            v.growth(need), ec);
+}
+
 auto
 url::
 segments_type::
 insert_encoded( iterator pos, string_view s ) ->
     iterator
 {
-    return insert_encoded_impl(pos, detail::pchar_pct_set().validate(s));
+    error_code ec;
+    auto const r =
+        insert_encoded(pos, s, ec);
+    raise_on_error(ec);
+    return r;
+}
+
+auto
+url::
+segments_type::
+insert_encoded(
+    iterator pos,
+    string_view s,
+    error_code& ec) ->
+        iterator
+{
+    ec = {};
+    if(! detail::pchar_pct_set().check(s))
+    {
+        ec = error::invalid;
+        return pos;
+    }
+    return insert_encoded_impl(pos, s, ec);
 }
 
 auto
@@ -1675,7 +2443,25 @@ segments_type::
 insert( iterator pos, string_view s ) ->
     iterator
 {
-    return insert_impl(pos, s, detail::pchar_pct_set().encoded_size(s));
+    error_code ec;
+    auto const r =
+        insert(pos, s, ec);
+    raise_on_error(ec);
+    return r;
+}
+
+auto
+url::
+segments_type::
+insert(
+    iterator pos,
+    string_view s,
+    error_code& ec) ->
+        iterator
+{
+    ec = {};
+    return insert_impl(pos, s,
+        detail::pchar_pct_set().encoded_size(s), ec);
 }
 
 auto
@@ -1684,37 +2470,69 @@ segments_type::
 replace_encoded( iterator pos, string_view s ) ->
     iterator
 {
-    detail::pchar_pct_set().validate(s);
-    BOOST_ASSERT(v_ != nullptr);
-    url& v = *v_; (void)v;
-    //auto const ns = s.size();
-    //auto const n0 = pos.n_;
-    //auto const n = ns + 1;
-// VFALCO This is to make insert and erase compose
-//        and offer the strong exception safety guarantee
-//if( n0 < n ) v.s_ = v.a_->reserve(v.size() + n - n0);
-    auto r = insert_encoded_impl(erase(pos), s);
+    error_code ec;
+    auto const r =
+        replace_encoded(pos, s, ec);
+    raise_on_error(ec);
     return r;
 }
 
+auto
+url::
+segments_type::
+replace_encoded(
+    iterator pos,
+    string_view s,
+    error_code& ec) ->
+        iterator
+{
+    BOOST_ASSERT(v_ != nullptr);
+    ec = {};
+    if(! detail::pchar_pct_set().check(s))
+    {
+        ec = error::invalid;
+        return pos;
+    }
+    reserve_replace(pos, s.size(), ec);
+    if(ec)
+        return pos;
+    return insert_encoded_impl(
+        erase(pos), s, ec);
+}
+
 auto
 url::
 segments_type::
 replace( iterator pos, string_view s ) ->
     iterator
 {
-    BOOST_ASSERT(v_ != nullptr);
-    url& v = *v_; (void)v;
-    auto const ns = detail::pchar_pct_set().encoded_size(s);
-    //auto const n0 = pos.n_;
-    //auto const n = ns + 1;
-// VFALCO This is to make insert and erase compose
-//        and offer the strong exception safety guarantee
-//if( n0 < n ) v.s_ = v.a_->reserve(v.size() + n - n0);
-    auto r = insert_impl(erase(pos), s, ns);
+    error_code ec;
+    auto const r =
+        replace(pos, s, ec);
+    raise_on_error(ec);
     return r;
 }
 
+auto
+url::
+segments_type::
+replace(
+    iterator pos,
+    string_view s,
+    error_code& ec) ->
+        iterator
+{
+    BOOST_ASSERT(v_ != nullptr);
+    ec = {};
+    auto const ns =
+        detail::pchar_pct_set().encoded_size(s);
+    reserve_replace(pos, ns, ec);
+    if(ec)
+        return pos;
+    return insert_impl(
+        erase(pos), s, ns, ec);
+}
+
 //------------------------------------------------
 //
 // params_type
@@ -1729,6 +2547,8 @@ iterator() noexcept
     , off_(0)
     , nk_(0)
     , nv_(0)
+    , dk_(0)
+    , dv_(0)
 {
 }
 
@@ -1745,6 +2565,8 @@ iterator(
         off_ = 0;
         nk_ = 0;
         nv_ = 0;
+        dk_ = 0;
+        dv_ = 0;
     }
     else if( end ||
             v_->pt_.nparam == 0)
@@ -1753,6 +2575,8 @@ iterator(
             id_frag];
         nk_ = 0;
         nv_ = 0;
+        dk_ = 0;
+        dv_ = 0;
     }
     else
     {
@@ -1781,13 +2605,13 @@ operator*() const noexcept ->
         v_->s_ + off_ + 1,
         nk_ - 1 };
     if(nv_ == 0)
-        return { k, { } };
+        return { k, dk_, { }, 0 };
     BOOST_ASSERT(
         v_->s_[off_ + nk_] == '=');
     string_view const v = {
         v_->s_ + off_ + nk_ + 1,
         nv_ - 1};
-    return { k, v };
+    return { k, dk_, v, dv_ };
 }
 
 auto
@@ -1809,6 +2633,8 @@ operator++() noexcept ->
         // end
         nv_ = 0;
         nk_ = 0;
+        dk_ = 0;
+        dv_ = 0;
     }
     else
     {
@@ -1857,7 +2683,7 @@ parse() noexcept
     BOOST_ASSERT(v_->pt_.nparam > 0);
     auto const end =
         v_->s_ + v_->pt_.offset[
-            id_end];
+            id_frag];
     char const* p = v_->s_ + off_;
     BOOST_ASSERT(
         ( off_ == v_->pt_.offset[
@@ -1870,19 +2696,20 @@ parse() noexcept
     auto const ek =
         detail::qkey_pct_set();
     error_code ec;
-    p = ek.parse(p, end, ec);
+    p = ek.parse(p, end, ec, dk_);
     BOOST_ASSERT(! ec);
     nk_ = p - p0;
     if(p == end)
     {
         nv_ = 0;
+        dv_ = 0;
         return;
     }
     auto const ev =
         detail::qval_pct_set();
     BOOST_ASSERT(*p == '=');
     p0 = p++;
-    p = ev.parse(p, end, ec);
+    p = ev.parse(p, end, ec, dv_);
     BOOST_ASSERT(! ec);
     nv_ = p - p0;
 }
@@ -1963,24 +2790,128 @@ operator[](string_view key) const
 
 //------------------------------------------------
 
+// Leaves a moved-from url empty, without
+// storage of its own. The caller has
+// taken ownership of the characters.
 void
 url::
-resize_impl(
-    std::size_t new_size)
+reset_impl() noexcept
 {
-    if(new_size > cap_)
+    pt_.clear();
+    if(ibuf_)
     {
-        // reallocate
+        s_ = ibuf_;
+        cap_ = icap_;
+        s_[0] = '\0';
+        return;
+    }
+    s_ = nullptr;
+    cap_ = 0;
+}
+
+// Replaces the contents with the valid
+// URL s, whose parts are pt
+void
+url::
+assign_impl(
+    string_view s,
+    detail::parts const& pt)
+{
+    if(s.size() > cap_)
+    {
+        if(fixed_)
+            too_large::raise();
         auto p = static_cast<char*>(
-            sp_->allocate(new_size + 1));
-        if(s_)
-        {
-            BOOST_ASSERT(cap_ != 0);
-            std::memcpy(p, s_, size() + 1);
+            sp_->allocate(s.size() + 1, 1));
+        if(s_ && s_ != ibuf_)
             sp_->deallocate(s_, cap_ + 1, 1);
-        }
         s_ = p;
-        cap_ = new_size;
+        cap_ = s.size();
+    }
+    pt_ = pt;
+    if(! s_)
+        return;
+    // s may be a part of this url
+    if(! s.empty())
+        std::memmove(
+            s_, s.data(), s.size());
+    s_[s.size()] = '\0';
+}
+
+// Returns the capacity to allocate when
+// growing to new_size, at least half again
+// the current capacity, so that a sequence
+// of setters reallocates a logarithmic
+// number of times.
+std::size_t
+url::
+growth(
+    std::size_t new_size) const noexcept
+{
+    // one less, leaving room
+    // for the null terminator
+    std::size_t const max =
+        (std::size_t)-1 - 1;
+    BOOST_ASSERT(new_size <= max);
+    if(cap_ > max - cap_ / 2)
+        return max;
+    auto const n = cap_ + cap_ / 2;
+    if(n < new_size)
+        return new_size;
+    return n;
+}
+
+void
+url::
+reserve_impl(
+    std::size_t new_cap)
+{
+    error_code ec;
+    reserve_impl(new_cap, ec);
+    if(ec)
+        too_large::raise();
+}
+
+void
+url::
+reserve_impl(
+    std::size_t new_cap,
+    error_code& ec)
+{
+    BOOST_ASSERT(new_cap > cap_);
+    if(fixed_)
+    {
+        ec = error::capacity_exceeded;
+        return;
+    }
+    auto p = static_cast<char*>(
+        sp_->allocate(new_cap + 1, 1));
+    if(s_)
+    {
+        std::memcpy(p, s_, size() + 1);
+        if(s_ != ibuf_)
+            sp_->deallocate(s_, cap_ + 1, 1);
+    }
+    else
+    {
+        p[0] = '\0';
+    }
+    s_ = p;
+    cap_ = new_cap;
+}
+
+void
+url::
+resize_impl(
+    std::size_t new_size,
+    error_code& ec)
+{
+    if(new_size > cap_)
+    {
+        reserve_impl(
+            growth(new_size), ec);
+        if(ec)
+            return;
     }
 
     s_[new_size] = '\0';
@@ -1990,20 +2921,49 @@ char*
 url::
 resize_impl(
     int id,
-    std::size_t new_size)
+    std::size_t new_size,
+    error_code& ec)
 {
-    return resize_impl(id, id + 1, new_size);
+    return resize_impl(
+        id, id + 1, new_size, ec);
 }
 
+// Only growing can fail, and then
+// the URL is left unchanged
 char*
 url::
 resize_impl(
     int first,
     int last,
-    std::size_t new_len)
+    std::size_t new_len,
+    error_code& ec)
 {
     auto const len =
         pt_.length(first, last);
+    if(new_len > len)
+    {
+        auto const n = static_cast<
+            std::size_t>(new_len - len);
+        // check for exceeding max size
+        if(n > (
+            (std::size_t)-1)/*max_size()*/ - size())
+        {
+            ec = error::capacity_exceeded;
+            return nullptr;
+        }
+        if(cap_ < size() + n)
+        {
+            reserve_impl(
+                growth(size() + n), ec);
+            if(ec)
+                return nullptr;
+        }
+    }
+    // the setter which called us
+    // may record the decoded size
+    for(auto i = first; i < last; ++i)
+        pt_.decoded[i] =
+            detail::parts::unknown;
     if(new_len == 0 && len == 0)
     {
         // VFALCO This happens
@@ -2036,27 +2996,6 @@ resize_impl(
     // growing
     auto const n = static_cast<
         std::size_t>(new_len - len);
-
-    // check for exceeding max size
-    if(n > (
-        (std::size_t)-1)/*max_size()*/ - size())
-        too_large::raise();
-
-    if(cap_ < size() + n)
-    {
-        // reallocate
-        auto p = static_cast<char*>(
-            sp_->allocate(cap_ + n + 1));
-        if(s_)
-        {
-            BOOST_ASSERT(cap_ != 0);
-            std::memcpy(p, s_, size() + 1);
-            sp_->deallocate(s_, cap_ + 1, 1);
-        }
-        s_ = p;
-        cap_ = cap_ + n;
-    }
-
     auto const pos =
         pt_.offset[last];
     std::memmove(
@@ -2076,6 +3015,40 @@ resize_impl(
     return s_ + pt_.offset[first];
 }
 
+//------------------------------------------------
+
+void
+parse_uri(
+    string_view s,
+    url& u,
+    error_code& ec)
+{
+    detail::parts p;
+    if(! detail::parse_dfa(s,
+            detail::dfa::uri, p, ec))
+        return;
+    if( u.fixed_ &&
+        s.size() > u.cap_)
+    {
+        ec = error::capacity_exceeded;
+        return;
+    }
+    u.assign_impl(s, p);
+}
+
+void
+parse_uri(
+    string_view s,
+    url& u)
+{
+    error_code ec;
+    parse_uri(s, u, ec);
+    if(ec == error::capacity_exceeded)
+        too_large::raise();
+    detail::maybe_throw(ec,
+        BOOST_CURRENT_LOCATION);
+}
+
 } // urls
 } // boost
 
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_COLUMNS_IPP
+#define BOOST_URL_IMPL_URL_COLUMNS_IPP
+
+#include <boost/url/url_columns.hpp>
+#include <boost/url/detail/dfa.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+// Capacity for the row must
+// already be reserved in
+// every column
+void
+url_columns::
+push(
+    char const* s,
+    detail::parts const& pt,
+    error_code const& ec)
+{
+    s_.push_back(s);
+    for(int id = 0; id < id_end; ++id)
+    {
+        end_[id].push_back(
+            pt.offset[id + 1]);
+        decoded_[id].push_back(
+            pt.decoded[id]);
+    }
+    nseg_.push_back(pt.nseg);
+    nparam_.push_back(pt.nparam);
+    port_.push_back(pt.port_number);
+    host_type_.push_back(pt.host_type);
+    ip_.insert(ip_.end(),
+        &pt.ip_addr[0], &pt.ip_addr[16]);
+    ec_.push_back(ec);
+}
+
+std::size_t
+url_columns::
+append(
+    string_view const* s,
+    std::size_t n,
+    bool relative)
+{
+    auto const k = relative ?
+        detail::dfa::relative_ref :
+        detail::dfa::uri;
+    // reserve first, so that push
+    // can't throw and leave the
+    // columns with different sizes.
+    // This also tops up any column
+    // an earlier failure left short.
+    reserve(n > s_.capacity() - size() ?
+        size() + (std::max)(n, size()) :
+        size() + n);
+    std::size_t nfail = 0;
+    error_code ec;
+    detail::parts pt;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(detail::parse_dfa(
+            s[i], k, pt, ec))
+        {
+            push(s[i].data(), pt, ec);
+            continue;
+        }
+        detail::parts empty;
+        std::memset(empty.ip_addr, 0,
+            sizeof(empty.ip_addr));
+        push("", empty, ec);
+        ++nfail;
+    }
+    return nfail;
+}
+
+void
+url_columns::
+clear() noexcept
+{
+    s_.clear();
+    for(int id = 0; id < id_end; ++id)
+    {
+        end_[id].clear();
+        decoded_[id].clear();
+    }
+    nseg_.clear();
+    nparam_.clear();
+    port_.clear();
+    host_type_.clear();
+    ip_.clear();
+    ec_.clear();
+}
+
+void
+url_columns::
+reserve(std::size_t n)
+{
+    s_.reserve(n);
+    for(int id = 0; id < id_end; ++id)
+    {
+        end_[id].reserve(n);
+        decoded_[id].reserve(n);
+    }
+    nseg_.reserve(n);
+    nparam_.reserve(n);
+    port_.reserve(n);
+    host_type_.reserve(n);
+    ip_.reserve(16 * n);
+    ec_.reserve(n);
+}
+
+std::size_t
+url_columns::
+append_uri(
+    string_view const* s,
+    std::size_t n)
+{
+    return append(s, n, false);
+}
+
+std::size_t
+url_columns::
+append_relative_ref(
+    string_view const* s,
+    std::size_t n)
+{
+    return append(s, n, true);
+}
+
+url_view
+url_columns::
+operator[](std::size_t i) const noexcept
+{
+    detail::parts pt;
+    for(int id = 0; id < id_end; ++id)
+    {
+        pt.offset[id + 1] = end_[id][i];
+        pt.decoded[id] = decoded_[id][i];
+    }
+    std::memcpy(pt.ip_addr,
+        &ip_[16 * i], 16);
+    pt.nseg = nseg_[i];
+    pt.nparam = nparam_[i];
+    pt.port_number = port_[i];
+    pt.host_type = host_type_[i];
+    return url_view(s_[i], pt);
+}
+
+string_view
+url_columns::
+scheme(std::size_t i) const noexcept
+{
+    auto s = get(id_scheme, i);
+    if(! s.empty())
+    {
+        BOOST_ASSERT(s.ends_with(':'));
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+string_view
+url_columns::
+encoded_query(std::size_t i) const noexcept
+{
+    auto s = get(id_query, i);
+    if(s.empty())
+        return s;
+    BOOST_ASSERT(s.starts_with('?'));
+    return s.substr(1);
+}
+
+string_view
+url_columns::
+encoded_fragment(std::size_t i) const noexcept
+{
+    auto s = get(id_frag, i);
+    if(s.empty())
+        return s;
+    BOOST_ASSERT(s.starts_with('#'));
+    return s.substr(1);
+}
+
+} // urls
+} // boost
+
+#endif
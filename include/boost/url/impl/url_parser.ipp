@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_URL_PARSER_IPP
+#define BOOST_URL_IMPL_URL_PARSER_IPP
+
+#include <boost/url/url_parser.hpp>
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+std::size_t
+url_parser::
+write(
+    string_view s,
+    error_code& ec) noexcept
+{
+    if(done_)
+    {
+        // no input after the end
+        ec = error::syntax;
+        return 0;
+    }
+    ec = {};
+    auto const n0 = d_.pos();
+    d_.write(s.data(), s.size(), ec);
+    return d_.pos() - n0;
+}
+
+std::size_t
+url_parser::
+write(string_view s)
+{
+    error_code ec;
+    auto const n = write(s, ec);
+    detail::maybe_throw(ec,
+        BOOST_CURRENT_LOCATION);
+    return n;
+}
+
+void
+url_parser::
+finish(error_code& ec) noexcept
+{
+    if(done_)
+    {
+        ec = {};
+        return;
+    }
+    ec = {};
+    done_ = d_.finish(ec);
+}
+
+void
+url_parser::
+finish()
+{
+    error_code ec;
+    finish(ec);
+    detail::maybe_throw(ec,
+        BOOST_CURRENT_LOCATION);
+}
+
+} // urls
+} // boost
+
+#endif
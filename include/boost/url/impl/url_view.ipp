@@ -12,11 +12,8 @@
 
 #include <boost/url/url_view.hpp>
 #include <boost/url/error.hpp>
+#include <boost/url/detail/dfa.hpp>
 #include <boost/url/detail/over_allocator.hpp>
-#include <boost/url/detail/parse.hpp>
-#include <boost/url/bnf/parse.hpp>
-#include <boost/url/rfc/uri_bnf.hpp>
-#include <boost/url/rfc/relative_ref_bnf.hpp>
 #include <array>
 #include <ostream>
 
@@ -164,7 +161,12 @@ has_authority() const noexcept
 {
     auto const n = len(id_user);
     if(n == 0)
-        return false;
+    {
+        // the authority-form of a
+        // request-target has no "//"
+        return pt_.length(
+            id_host, id_path) != 0;
+    }
     BOOST_ASSERT(get(
         id_user).starts_with("//"));
     return true;
@@ -175,9 +177,10 @@ url_view::
 encoded_authority() const noexcept
 {
     auto s = get(id_user, id_path);
-    if(! s.empty())
+    if(len(id_user) != 0)
     {
-        BOOST_ASSERT(has_authority());
+        BOOST_ASSERT(
+            s.starts_with("//"));
         s.remove_prefix(2);
     }
     return s;
@@ -481,33 +484,10 @@ parse_uri(
     string_view s,
     error_code& ec) noexcept
 {
-    uri_bnf t;
-    if(! bnf::parse(s, ec, t))
-        return {};
-
     detail::parts p;
-
-    // scheme
-    p.resize(
-        detail::part::id_scheme,
-        t.scheme.str.size() + 1);
-
-    // authority
-    detail::apply_authority(
-        p, t.authority);
-
-    // path
-    detail::apply_path(
-        p, t.path);
-
-    // query
-    detail::apply_query(
-        p, t.query);
-
-    // fragment
-    detail::apply_fragment(
-        p, t.fragment);
-
+    if(! detail::parse_dfa(s,
+            detail::dfa::uri, p, ec))
+        return {};
     return url_view(s.data(), p);
 }
 
@@ -527,30 +507,11 @@ parse_relative_ref(
     string_view s,
     error_code& ec) noexcept
 {
-    relative_ref_bnf t;
-    if(! bnf::parse(s, ec, t))
-        return {};
-
     detail::parts p;
-
-    // authority
-    detail::apply_authority(
-        p, t.authority);
-
-    // path
-    detail::apply_path(
-        p, t.path);
-
-    // query
-    detail::apply_query(
-        p, t.query);
-
-    // fragment
-    detail::apply_fragment(
-        p, t.fragment);
-
-    return url_view(
-        s.data(), p);
+    if(! detail::parse_dfa(s,
+            detail::dfa::relative_ref, p, ec))
+        return {};
+    return url_view(s.data(), p);
 }
 
 url_view
@@ -564,6 +525,61 @@ parse_relative_ref(
     return u;
 }
 
+std::size_t
+parse_uri_batch(
+    string_view const* s,
+    std::size_t n,
+    url_view* u,
+    error_code* ec) noexcept
+{
+    std::size_t nfail = 0;
+    error_code e;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(detail::parse_dfa(s[i],
+            detail::dfa::uri, u[i].pt_, e))
+        {
+            u[i].s_ = s[i].data();
+        }
+        else
+        {
+            u[i] = {};
+            ++nfail;
+        }
+        if(ec)
+            ec[i] = e;
+    }
+    return nfail;
+}
+
+std::size_t
+parse_relative_ref_batch(
+    string_view const* s,
+    std::size_t n,
+    url_view* u,
+    error_code* ec) noexcept
+{
+    std::size_t nfail = 0;
+    error_code e;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(detail::parse_dfa(s[i],
+            detail::dfa::relative_ref,
+                u[i].pt_, e))
+        {
+            u[i].s_ = s[i].data();
+        }
+        else
+        {
+            u[i] = {};
+            ++nfail;
+        }
+        if(ec)
+            ec[i] = e;
+    }
+    return nfail;
+}
+
 std::ostream&
 operator<<(
     std::ostream& os,
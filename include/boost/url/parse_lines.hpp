@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_PARSE_LINES_HPP
+#define BOOST_URL_PARSE_LINES_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url_view.hpp>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** The result of parsing a newline-delimited buffer
+
+    The buffer is split into chunks on line
+    boundaries, and the chunks are parsed in
+    parallel. Results are kept per chunk, in
+    buffer order, so concatenating the chunks
+    reproduces the order of the lines. All
+    views reference the characters of the
+    buffer, which must remain valid for as
+    long as the results are used.
+
+    @see parse_uri_lines, parse_relative_ref_lines
+*/
+struct parsed_lines
+{
+    /** The results for one chunk of the buffer
+    */
+    struct chunk
+    {
+        /** The lines making up this chunk
+        */
+        string_view text;
+
+        /** The lines which parsed successfully
+        */
+        std::vector<url_view> urls;
+
+        /** The lines which failed to parse
+        */
+        std::vector<string_view> failures;
+    };
+
+    /** Totals for one thread of the pool
+    */
+    struct worker
+    {
+        /** The number of chunks parsed
+        */
+        std::size_t chunks = 0;
+
+        /** The number of non-empty lines parsed
+        */
+        std::size_t lines = 0;
+
+        /** The number of lines which failed to parse
+        */
+        std::size_t errors = 0;
+    };
+
+    /** The chunks, in buffer order
+    */
+    std::vector<chunk> chunks;
+
+    /** The totals for each thread
+    */
+    std::vector<worker> workers;
+};
+
+/** Parse each line of a buffer as a URI
+
+    Each line of `text` is parsed as if by
+    @ref parse_uri. Lines end at '\n', a
+    trailing '\r' is removed, and empty lines
+    are skipped. The buffer is divided into
+    chunks ending on line boundaries, and the
+    chunks are handed out to a pool of threads
+    as each thread finishes its previous chunk.
+
+    No characters are copied; this is suited
+    to parsing a memory-mapped file.
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param text The buffer to parse.
+
+    @param threads The number of threads to use,
+    including the calling thread. If zero, the
+    number of hardware threads is used.
+
+    @param chunk_size The approximate size of
+    each chunk in bytes. If zero, a size is
+    chosen based on the buffer size and the
+    number of threads.
+*/
+BOOST_URL_DECL
+parsed_lines
+parse_uri_lines(
+    string_view text,
+    std::size_t threads = 0,
+    std::size_t chunk_size = 0);
+
+/** Parse each line of a buffer as a relative-ref
+
+    Each line of `text` is parsed as if by
+    @ref parse_relative_ref, otherwise this
+    behaves the same as @ref parse_uri_lines.
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @param text The buffer to parse.
+
+    @param threads The number of threads to use,
+    including the calling thread. If zero, the
+    number of hardware threads is used.
+
+    @param chunk_size The approximate size of
+    each chunk in bytes. If zero, a size is
+    chosen based on the buffer size and the
+    number of threads.
+*/
+BOOST_URL_DECL
+parsed_lines
+parse_relative_ref_lines(
+    string_view text,
+    std::size_t threads = 0,
+    std::size_t chunk_size = 0);
+
+} // urls
+} // boost
+
+#endif
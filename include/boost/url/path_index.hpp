@@ -0,0 +1,159 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_PATH_INDEX_HPP
+#define BOOST_URL_PATH_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/path_view.hpp>
+#include <boost/url/string.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A random-access index of path segments
+
+    The index records where each segment of a
+    @ref path_view begins, in a buffer supplied
+    by the caller. It is built in one pass, and
+    afterwards any segment, including the last,
+    is reached in constant time.
+
+    Neither the path nor the buffer are owned.
+    Both must remain valid for as long as the
+    index is used.
+
+    @par Example
+    @code
+    std::size_t buf[32];
+    path_index idx( u.path(), buf, 32 );
+    if( idx.size() >= 2 &&
+        idx.encoded_segment( 0 ) == "api" )
+        route( idx[ 1 ], idx.back() );
+    @endcode
+*/
+class path_index
+{
+    char const* s_ = "";
+
+    // segment i is [off_[i], off_[i+1] - 1)
+    std::size_t* off_ = nullptr;
+    std::size_t n_ = 0;
+
+public:
+    /// The type of segment
+    using value_type =
+        path_view::value_type;
+
+    /** Constructor
+
+        Default constructed indexes are empty.
+    */
+    path_index() = default;
+
+    /** Build an index of the segments of a path
+
+        @param p The path.
+
+        @param buf A buffer to hold the index.
+
+        @param buf_size The number of elements
+        in `buf`, which must be at least
+        `buffer_size( p )`.
+
+        @throw std::length_error `buf_size` is
+        too small.
+    */
+    BOOST_URL_DECL
+    path_index(
+        path_view p,
+        std::size_t* buf,
+        std::size_t buf_size);
+
+    /** Return the number of buffer elements needed to index a path
+    */
+    static
+    std::size_t
+    buffer_size(
+        path_view p) noexcept
+    {
+        return p.size() + 1;
+    }
+
+    /** Return true if there are no segments
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return the number of segments
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return segment `i` as a percent-encoded string
+
+        @par Preconditions
+        `i < size()`
+    */
+    string_view
+    encoded_segment(
+        std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < n_);
+        return string_view(
+            s_ + off_[i],
+            off_[i + 1] - off_[i] - 1);
+    }
+
+    /** Return segment `i`
+
+        @par Preconditions
+        `i < size()`
+    */
+    BOOST_URL_DECL
+    value_type
+    operator[](
+        std::size_t i) const noexcept;
+
+    /** Return the first segment
+
+        @par Preconditions
+        `! empty()`
+    */
+    value_type
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /** Return the last segment
+
+        @par Preconditions
+        `! empty()`
+    */
+    value_type
+    back() const noexcept
+    {
+        BOOST_ASSERT(n_ > 0);
+        return (*this)[n_ - 1];
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_URL_PATH_VIEW_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/pct_decoded_view.hpp>
 #include <boost/url/string.hpp>
 #include <boost/url/detail/char_type.hpp>
 #include <boost/url/rfc/pct_encoded_bnf.hpp>
@@ -20,7 +21,7 @@
 namespace boost {
 namespace urls {
 
-/** A ForwardRange view of read-only path segments
+/** A BidirectionalRange view of read-only path segments
 */
 class path_view
 {
@@ -29,6 +30,7 @@ class path_view
 
     friend class url;
     friend class url_view;
+    friend class path_index;
 
     path_view(
         string_view s,
@@ -66,6 +68,24 @@ public:
         return n_;
     }
 
+    /** Return the first segment
+
+        @par Preconditions
+        `! empty()`
+    */
+    value_type
+    front() const noexcept;
+
+    /** Return the last segment
+
+        Only the last segment is scanned.
+
+        @par Preconditions
+        `! empty()`
+    */
+    value_type
+    back() const noexcept;
+
     /** Return an iterator to the beginning of the range
     */
     BOOST_URL_DECL
@@ -117,6 +137,7 @@ class path_view::value_type
 
     friend class iterator;
     friend class path_view;
+    friend class path_index;
 
 public:
     value_type() = default;
@@ -166,6 +187,18 @@ public:
             s_.str, s_.decoded_size, a);
     }
 
+    /** Return the segment as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_segment() const noexcept
+    {
+        return pct_decoded_view(
+            s_.str, s_.decoded_size);
+    }
+
     value_type const*
     operator->() const noexcept
     {
@@ -0,0 +1,533 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_PCT_DECODED_VIEW_HPP
+#define BOOST_URL_PCT_DECODED_VIEW_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/string.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+namespace boost {
+namespace urls {
+
+/** A read-only view of a percent-encoded string, decoded on the fly
+
+    Objects of this type refer to a valid
+    percent-encoded string and present the
+    characters of its decoded form, without
+    allocating. Iteration, comparison, hashing,
+    and numeric conversion each decode as they
+    go; @ref copy and @ref to_string produce the
+    decoded characters all at once.
+
+    The underlying character buffer is not
+    owned, and must remain valid for as long
+    as the view is in use.
+
+    @par Preconditions
+    The viewed string is a valid
+    percent-encoded string.
+*/
+class pct_decoded_view
+{
+    char const* p_ = "";
+    std::size_t n_ = 0;
+    std::size_t dn_ = 0;
+
+public:
+    class iterator;
+
+    /// The type of iterator used to visit decoded characters
+    using const_iterator = iterator;
+
+    /// The type of decoded character
+    using value_type = char;
+
+    pct_decoded_view() = default;
+    pct_decoded_view(
+        pct_decoded_view const&) = default;
+    pct_decoded_view& operator=(
+        pct_decoded_view const&) = default;
+
+    /** Construct a view of an encoded string
+
+        The decoded size is calculated from
+        the encoded string.
+
+        @par Complexity
+        Linear in `s.size()`.
+    */
+    BOOST_URL_DECL
+    explicit
+    pct_decoded_view(
+        string_view s) noexcept;
+
+    /** Construct a view of an encoded string with a known decoded size
+
+        @par Preconditions
+        `decoded_size == pct_decoded_size_unchecked(s)`
+
+        @par Complexity
+        Constant.
+    */
+    BOOST_URL_DECL
+    pct_decoded_view(
+        string_view s,
+        std::size_t decoded_size) noexcept;
+
+    /** Return the percent-encoded string
+    */
+    string_view
+    encoded() const noexcept
+    {
+        return string_view(p_, n_);
+    }
+
+    /** Return the number of decoded characters
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return dn_;
+    }
+
+    /** Return true if there are no decoded characters
+    */
+    bool
+    empty() const noexcept
+    {
+        return dn_ == 0;
+    }
+
+    /** Return an iterator to the first decoded character
+    */
+    inline
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to one past the last decoded character
+    */
+    inline
+    iterator
+    end() const noexcept;
+
+    /** Copy decoded characters to a caller-provided buffer
+
+        Up to `count` characters from the start
+        of the decoded string are written to `dest`.
+        No null terminator is added.
+
+        @return The number of characters written,
+        which is the smaller of `count` and `size()`.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    copy(
+        char* dest,
+        std::size_t count) const noexcept;
+
+    /** Decode the whole string into a caller-provided buffer
+
+        If the decoded string fits in the range
+        `[first, last)` it is written there, with
+        no null terminator. Otherwise nothing is
+        written. In either case the decoded size
+        is returned, so a caller can size a buffer
+        with @ref size and decode into it, or try
+        a fixed buffer first and fall back when
+        the return value exceeds its capacity:
+
+        @code
+        char buf[256];
+        auto const n = u.decoded_host().decode_into(
+            buf, buf + sizeof(buf));
+        if(n <= sizeof(buf))
+            use(string_view(buf, n));
+        @endcode
+
+        @return The number of characters in
+        the decoded string.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    decode_into(
+        char* first,
+        char* last) const noexcept;
+
+    /** Return the decoded string
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param a An optional allocator the returned
+        string will use. If this parameter is omitted,
+        the default allocator is used, and the return
+        type of the function becomes `std::string`.
+
+        @return A `std::basic_string` using the
+        specified allocator.
+    */
+    template<
+        class Allocator =
+            std::allocator<char>>
+    string_type<Allocator>
+    to_string(
+        Allocator const& a = {}) const;
+
+    /** Compare the decoded string with another string
+
+        @return A negative value, zero, or a
+        positive value if the decoded string
+        compares less than, equal to, or greater
+        than `s`, as if by `string_view::compare`.
+    */
+    BOOST_URL_DECL
+    int
+    compare(string_view s) const noexcept;
+
+    /** Compare the decoded string with another decoded string
+    */
+    BOOST_URL_DECL
+    int
+    compare(
+        pct_decoded_view const& other) const noexcept;
+
+    /** Return the decoded string as an unsigned decimal number
+
+        The decoded string must consist of one or
+        more decimal digits whose value fits in
+        `Unsigned`. Otherwise, `error::syntax` or
+        `error::number_overflow` is set in `ec`
+        and zero is returned.
+    */
+    template<class Unsigned>
+    Unsigned
+    to_number(
+        error_code& ec) const noexcept;
+
+    /** Return the decoded string as an unsigned decimal number
+
+        @throw system_error The decoded string
+        is not a number, or it does not fit.
+    */
+    template<class Unsigned>
+    Unsigned
+    to_number() const;
+
+    /** Return a hash of the decoded string
+
+        Two views whose decoded strings are
+        equal produce the same hash, regardless
+        of how their characters were encoded.
+    */
+    friend
+    std::size_t
+    hash_value(
+        pct_decoded_view const& v) noexcept
+    {
+        return v.hash();
+    }
+
+    friend
+    bool
+    operator==(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return v0.size() == v1.size() &&
+            v0.compare(v1) == 0;
+    }
+
+    friend
+    bool
+    operator==(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return v.size() == s.size() &&
+            v.compare(s) == 0;
+    }
+
+    friend
+    bool
+    operator==(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return v == s;
+    }
+
+    friend
+    bool
+    operator!=(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return ! (v0 == v1);
+    }
+
+    friend
+    bool
+    operator!=(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return ! (v == s);
+    }
+
+    friend
+    bool
+    operator!=(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return ! (v == s);
+    }
+
+    friend
+    bool
+    operator<(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return v0.compare(v1) < 0;
+    }
+
+    friend
+    bool
+    operator<(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return v.compare(s) < 0;
+    }
+
+    friend
+    bool
+    operator<(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return v.compare(s) > 0;
+    }
+
+    friend
+    bool
+    operator<=(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return v0.compare(v1) <= 0;
+    }
+
+    friend
+    bool
+    operator<=(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return v.compare(s) <= 0;
+    }
+
+    friend
+    bool
+    operator<=(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return v.compare(s) >= 0;
+    }
+
+    friend
+    bool
+    operator>(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return v0.compare(v1) > 0;
+    }
+
+    friend
+    bool
+    operator>(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return v.compare(s) > 0;
+    }
+
+    friend
+    bool
+    operator>(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return v.compare(s) < 0;
+    }
+
+    friend
+    bool
+    operator>=(
+        pct_decoded_view const& v0,
+        pct_decoded_view const& v1) noexcept
+    {
+        return v0.compare(v1) >= 0;
+    }
+
+    friend
+    bool
+    operator>=(
+        pct_decoded_view const& v,
+        string_view s) noexcept
+    {
+        return v.compare(s) >= 0;
+    }
+
+    friend
+    bool
+    operator>=(
+        string_view s,
+        pct_decoded_view const& v) noexcept
+    {
+        return v.compare(s) <= 0;
+    }
+
+private:
+    BOOST_URL_DECL
+    std::size_t
+    hash() const noexcept;
+};
+
+//----------------------------------------------------------
+
+/** A bidirectional iterator over decoded characters
+*/
+class pct_decoded_view::iterator
+{
+    char const* first_ = nullptr;
+    char const* p_ = nullptr;
+
+    friend class pct_decoded_view;
+
+    iterator(
+        char const* first,
+        char const* p) noexcept
+        : first_(first)
+        , p_(p)
+    {
+    }
+
+public:
+    using value_type = char;
+    using reference = char;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    iterator() = default;
+    iterator(
+        iterator const&) = default;
+    iterator& operator=(
+        iterator const&) = default;
+
+    BOOST_URL_DECL
+    char
+    operator*() const noexcept;
+
+    iterator&
+    operator++() noexcept
+    {
+        p_ += *p_ == '%' ? 3 : 1;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    // In a valid encoding every '%'
+    // begins an escape, so a '%' three
+    // characters back means the previous
+    // character is that escape.
+    iterator&
+    operator--() noexcept
+    {
+        p_ -= (p_ - first_ >= 3 &&
+            p_[-3] == '%') ? 3 : 1;
+        return *this;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    /** Return a pointer to the encoded character or escape
+    */
+    char const*
+    encoded() const noexcept
+    {
+        return p_;
+    }
+
+    friend
+    bool
+    operator==(
+        iterator a,
+        iterator b) noexcept
+    {
+        return a.p_ == b.p_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator a,
+        iterator b) noexcept
+    {
+        return a.p_ != b.p_;
+    }
+};
+
+} // urls
+} // boost
+
+namespace std {
+
+template<>
+struct hash<::boost::urls::pct_decoded_view>
+{
+    std::size_t
+    operator()(
+        ::boost::urls::pct_decoded_view const& v) const noexcept
+    {
+        return hash_value(v);
+    }
+};
+
+} // std
+
+#include <boost/url/impl/pct_decoded_view.hpp>
+
+#endif
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_QUERY_KEY_MATCHER_HPP
+#define BOOST_URL_QUERY_KEY_MATCHER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_decoded_view.hpp>
+#include <boost/url/query_params_view.hpp>
+#include <boost/url/string.hpp>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A prepared set of query keys to look for
+
+    The keys are plain, decoded strings. They
+    are copied and grouped by length when the
+    matcher is constructed, so that matching
+    a key from a query first selects the keys
+    of the same decoded length and then
+    compares bytes. Keys which contain no
+    percent-escapes are compared with
+    `memcmp`; only keys which do are decoded,
+    as they are compared.
+
+    A matcher is typically built once, for
+    example as a `static const` object, and
+    used with @ref extract_query_params or
+    @ref for_each_query_param on every query.
+
+    @par Example
+    @code
+    static query_key_matcher const keys{
+        "page", "limit", "sort" };
+
+    query_params_view::iterator v[3];
+    extract_query_params(
+        u.query_params(), keys, v );
+    @endcode
+*/
+class query_key_matcher
+{
+    std::vector<std::string> keys_;
+
+    // order_[first_[n]] through
+    // order_[first_[n+1]-1] are the
+    // indexes of the keys of length n
+    std::vector<std::uint32_t> order_;
+    std::vector<std::uint32_t> first_;
+
+    void
+    build();
+
+public:
+    /// Returned by @ref find when no key matches
+    static constexpr std::size_t npos =
+        std::size_t(-1);
+
+    /** Construct a matcher for a list of keys
+
+        The index of each key in the list is
+        the value @ref find returns for it. If a
+        key appears more than once, only its
+        first index is ever returned.
+    */
+    BOOST_URL_DECL
+    query_key_matcher(
+        std::initializer_list<
+            string_view> keys);
+
+    /** Construct a matcher for an array of keys
+
+        @see query_key_matcher(std::initializer_list<string_view>)
+    */
+    BOOST_URL_DECL
+    query_key_matcher(
+        string_view const* keys,
+        std::size_t n);
+
+    /** Return the number of keys
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    /** Return the key at index `i`
+    */
+    string_view
+    operator[](std::size_t i) const noexcept
+    {
+        return keys_[i];
+    }
+
+    /** Return the index of the key equal to a decoded query key
+
+        @return The index of the matching key,
+        or @ref npos if there is none.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    find(pct_decoded_view key) const noexcept;
+};
+
+/** Find the first occurrence of each key in one pass
+
+    The query parameters are visited once, in
+    order. For every key of the matcher, the
+    corresponding element of `out` is set to
+    the first parameter with that key, or to
+    `qp.end()` if there is none. The walk stops
+    early once every key has been found.
+
+    @param qp The query parameters.
+
+    @param m The keys to look for.
+
+    @param out An array of `m.size()` iterators.
+
+    @return The number of keys found.
+*/
+BOOST_URL_DECL
+std::size_t
+extract_query_params(
+    query_params_view qp,
+    query_key_matcher const& m,
+    query_params_view::iterator* out);
+
+/** Visit every occurrence of the keys in one pass
+
+    The query parameters are visited once, in
+    order. For each parameter whose key matches,
+    the handler is invoked as if by
+
+    @code
+    h( std::size_t index, query_params_view::value_type const& v )
+    @endcode
+
+    where `index` is the index of the key in
+    the matcher.
+*/
+template<class Handler>
+void
+for_each_query_param(
+    query_params_view qp,
+    query_key_matcher const& m,
+    Handler&& h);
+
+} // urls
+} // boost
+
+#include <boost/url/impl/query_key_matcher.hpp>
+
+#endif
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_QUERY_PARAMS_INDEX_HPP
+#define BOOST_URL_QUERY_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/query_params_view.hpp>
+#include <boost/url/string.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** An index of query parameters for repeated lookup by key
+
+    The parameters of a @ref query_params_view
+    are parsed once and stored in order in a
+    flat table, alongside a hash of each decoded
+    key and an open-addressed table of slots.
+    After that, each lookup by key costs a hash
+    of the key and a short probe, instead of a
+    walk over the whole query string.
+
+    Like @ref query_params_view, the index
+    references the characters of the query
+    string, which must remain valid for as
+    long as the index is used.
+
+    The caller owns the index. Calling
+    @ref assign again reuses its storage, so
+    an index kept across requests stops
+    allocating once it has grown to fit the
+    largest query seen.
+
+    @par Example
+    @code
+    query_params_index idx;
+    idx.assign( u.query_params() );
+    auto const page = idx[ "page" ];
+    if( idx.contains( "debug" ) )
+        ...
+    @endcode
+*/
+class query_params_index
+{
+public:
+    /// The type of element in the index
+    using value_type =
+        query_params_view::value_type;
+
+    /// The type of iterator, visiting the parameters in order
+    using const_iterator =
+        value_type const*;
+
+    /// The type of iterator, visiting the parameters in order
+    using iterator = const_iterator;
+
+private:
+    std::vector<value_type> v_;
+    std::vector<std::size_t> hash_;
+
+    // index + 1 into v_, or 0 if empty
+    std::vector<std::uint32_t> slot_;
+
+    // the slot of each element of v_
+    std::vector<std::uint32_t> pos_;
+
+    std::size_t
+    probe(
+        string_view key,
+        std::size_t h,
+        std::size_t j,
+        std::size_t first) const noexcept;
+
+    std::size_t
+    index(std::size_t j) const noexcept;
+
+public:
+    /** Constructor
+
+        Default constructed indexes are empty.
+    */
+    query_params_index() = default;
+
+    /** Construct an index of the query parameters
+
+        @see assign
+    */
+    BOOST_URL_DECL
+    explicit
+    query_params_index(
+        query_params_view qp);
+
+    /** Replace the contents with an index of the query parameters
+
+        Storage from earlier calls is reused.
+
+        @par Complexity
+        Linear in the size of the query string.
+    */
+    BOOST_URL_DECL
+    void
+    assign(query_params_view qp);
+
+    /** Remove all parameters
+
+        Capacity is retained.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Return true if the index contains no parameters
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return the number of parameters
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return an iterator to the first parameter
+    */
+    const_iterator
+    begin() const noexcept
+    {
+        return v_.data();
+    }
+
+    /** Return an iterator to one past the last parameter
+    */
+    const_iterator
+    end() const noexcept
+    {
+        return v_.data() + v_.size();
+    }
+
+    /** Return true if the key exists
+
+        The key is compared against the
+        decoded keys of the parameters.
+    */
+    BOOST_URL_DECL
+    bool
+    contains(string_view key) const noexcept;
+
+    /** Return the number of matching keys
+    */
+    BOOST_URL_DECL
+    std::size_t
+    count(string_view key) const noexcept;
+
+    /** Find the first occurrence of a key
+
+        @return An iterator to the parameter,
+        or `end()` if the key does not exist.
+    */
+    BOOST_URL_DECL
+    const_iterator
+    find(string_view key) const noexcept;
+
+    /** Find the next occurrence of a key
+
+        @return An iterator to the first matching
+        parameter after `after`, or `end()` if
+        there is none.
+    */
+    BOOST_URL_DECL
+    const_iterator
+    find(
+        const_iterator after,
+        string_view key) const noexcept;
+
+    /** Return the value for a key, or the empty string
+    */
+    BOOST_URL_DECL
+    std::string
+    operator[](string_view key) const;
+
+    /** Return the value for the first matching key if it exists, otherwise throw
+    */
+    template<class Allocator =
+        std::allocator<char>>
+    string_type<Allocator>
+    at( string_view key,
+        Allocator const& a = {}) const;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/query_params_index.hpp>
+
+#endif
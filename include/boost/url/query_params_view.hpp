@@ -11,6 +11,7 @@
 #define BOOST_URL_QUERY_PARAMS_VIEW_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/pct_decoded_view.hpp>
 #include <boost/url/string.hpp>
 #include <boost/url/detail/char_type.hpp>
 #include <boost/url/rfc/pct_encoded_bnf.hpp>
@@ -20,6 +21,12 @@
 namespace boost {
 namespace urls {
 
+#ifndef BOOST_URL_DOCS
+namespace detail {
+class buffers_parser;
+} // detail
+#endif
+
 /** A ForwardRange view of read-only query parameters
 */
 class query_params_view
@@ -29,6 +36,7 @@ class query_params_view
 
     friend class url;
     friend class url_view;
+    friend class detail::buffers_parser;
 
     query_params_view(
         string_view s,
@@ -165,6 +173,7 @@ class query_params_view::value_type
 
     friend class iterator;
     friend class query_params_view;
+    friend class query_params_index;
 
 public:
     value_type() = default;
@@ -240,6 +249,30 @@ public:
             v_.str, v_.decoded_size, a);
     }
 
+    /** Return the key as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_key() const noexcept
+    {
+        return pct_decoded_view(
+            k_.str, k_.decoded_size);
+    }
+
+    /** Return the value as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_value() const noexcept
+    {
+        return pct_decoded_view(
+            v_.str, v_.decoded_size);
+    }
+
     value_type const*
     operator->() const noexcept
     {
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_REQUEST_TARGET_HPP
+#define BOOST_URL_REQUEST_TARGET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url_view.hpp>
+
+namespace boost {
+namespace urls {
+
+/** The form of an HTTP request-target
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc7230#section-5.3
+*/
+enum class target_form
+{
+    /** absolute-path [ "?" query ]
+
+        The view has a path and possibly a
+        query, and nothing else. Used for
+        most requests to origin servers.
+    */
+    origin,
+
+    /** absolute-URI
+
+        The view has a scheme and no fragment.
+        Used for requests to proxies.
+    */
+    absolute,
+
+    /** uri-host ":" port
+
+        The view has a host and a port, and
+        nothing else. There is no leading
+        "//", but `has_authority()` is true
+        and `encoded_authority()` returns the
+        whole target. Used for CONNECT.
+    */
+    authority,
+
+    /** "*"
+
+        The view has the path "*".
+        Used for a server-wide OPTIONS.
+    */
+    asterisk
+};
+
+/** Parse an HTTP request-target
+
+    The form is chosen from the input:
+
+    @li A target starting with '/' is parsed as
+    origin-form. A leading "//" begins the path,
+    not an authority.
+
+    @li The target "*" is asterisk-form.
+
+    @li Otherwise the target is parsed as
+    absolute-form. A target which fails, or
+    which has no authority, no query, and a
+    path made only of digits, such as
+    "example.com:443", is parsed instead as
+    authority-form.
+
+    Origin-form and asterisk-form are recognized
+    from the first character and parsed without
+    looking for a scheme.
+
+    @par BNF
+    @code
+    request-target = origin-form
+                   / absolute-form
+                   / authority-form
+                   / asterisk-form
+
+    origin-form    = absolute-path [ "?" query ]
+    absolute-form  = absolute-URI
+    authority-form = uri-host ":" port
+    asterisk-form  = "*"
+    @endcode
+
+    @param s The string to parse.
+
+    @param form Set to the form of the target,
+    if no error occurs.
+
+    @param ec Set to the error, if any.
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc7230#section-5.3
+*/
+BOOST_URL_DECL
+url_view
+parse_request_target(
+    string_view s,
+    target_form& form,
+    error_code& ec) noexcept;
+
+/** Parse an HTTP request-target
+
+    @param s The string to parse.
+
+    @param form Set to the form of the target.
+
+    @throw system_error The input is invalid.
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc7230#section-5.3
+*/
+BOOST_URL_DECL
+url_view
+parse_request_target(
+    string_view s,
+    target_form& form);
+
+} // urls
+} // boost
+
+#endif
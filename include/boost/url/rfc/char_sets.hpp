@@ -12,39 +12,12 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/bnf/char_set.hpp>
+#include <boost/url/detail/char_table.hpp>
 #include <cstdint>
 
 namespace boost {
 namespace urls {
 
-#ifndef BOOST_URL_DOCS
-namespace detail {
-BOOST_URL_DECL
-extern
-std::uint8_t
-char_set_flags[256];
-} // detail
-#endif
-
-/** Character set using bitmasks for membership
-*/
-template<std::uint8_t Mask>
-class masked_char_set
-{
-    std::uint8_t const* tab_ =
-        detail::char_set_flags;
-
-public:
-    bool
-    operator()(char c) const noexcept
-    {
-        return (tab_[static_cast<
-            std::uint8_t>(c)] & Mask) != 0;
-    }
-};
-
-//------------------------------------------------
-
 /** Mask for query characters, excluding equals and ampersand
 
     This is the unreserved set combined with the
@@ -218,6 +191,112 @@ constexpr std::uint8_t pchar_mask =
     colon_char_mask |
     at_char_mask;
 
+#ifndef BOOST_URL_DOCS
+namespace detail {
+
+constexpr
+bool
+is_query_char(char c) noexcept
+{
+    return
+        bnf::alnum_chars{}(c) ||
+        c == '-' || c == '.' ||
+        c == '_' || c == '~' ||
+        c == '!' || c == '$' ||
+        c == '\'' || c == '(' ||
+        c == ')' || c == '*' ||
+        c == '+' || c == ',' ||
+        c == ';';
+}
+
+constexpr
+bool
+is_gen_delim(char c) noexcept
+{
+    return
+        c == ':' || c == '/' ||
+        c == '?' || c == '#' ||
+        c == '[' || c == ']' ||
+        c == '@';
+}
+
+// Returns the mask bits for a character
+constexpr
+std::uint8_t
+char_set_flags(char c) noexcept
+{
+    return static_cast<std::uint8_t>(
+        (is_query_char(c) ? query_char_mask : 0) |
+        (c == '&' ? amper_char_mask : 0) |
+        (c == '=' ? equals_char_mask : 0) |
+        (is_gen_delim(c) ? gen_delims_char_mask : 0) |
+        (c == '?' ? question_char_mask : 0) |
+        (c == ':' ? colon_char_mask : 0) |
+        (c == '/' ? slash_char_mask : 0) |
+        (c == '@' ? at_char_mask : 0));
+}
+
+template<std::uint8_t Mask>
+struct masked_char_pred
+{
+    constexpr
+    bool
+    operator()(char c) const noexcept
+    {
+        return (char_set_flags(c) & Mask) != 0;
+    }
+};
+
+} // detail
+#endif
+
+//------------------------------------------------
+
+/** Character set using bitmasks for membership
+
+    This is an empty type. Membership tests are
+    evaluated against a table computed at compile
+    time, and searches for characters in or out
+    of the set use vector instructions when the
+    CPU supports them.
+*/
+template<std::uint8_t Mask>
+class masked_char_set
+{
+    using table = detail::char_table<
+        detail::masked_char_pred<Mask>>;
+
+public:
+    constexpr
+    bool
+    operator()(char c) const noexcept
+    {
+        return table::contains(c);
+    }
+
+    /** Return the first character in the range that is in the set
+    */
+    char const*
+    find_if(
+        char const* first,
+        char const* last) const noexcept
+    {
+        return detail::simd_find_if(
+            first, last, table::nibbles);
+    }
+
+    /** Return the first character in the range that is not in the set
+    */
+    char const*
+    find_if_not(
+        char const* first,
+        char const* last) const noexcept
+    {
+        return detail::simd_find_if_not(
+            first, last, table::nibbles);
+    }
+};
+
 } // urls
 } // boost
 
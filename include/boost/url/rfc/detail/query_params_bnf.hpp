@@ -51,11 +51,7 @@ struct query_params_bnf
                 masked_char_set<
                     qpchar_mask |
                     equals_char_mask>>{*t.value}))
-        {
-            ec = {};
-            t.value.reset();
-            return true;
-        }
+            return false;
         return true;
     }
 
@@ -96,11 +92,7 @@ struct query_params_bnf
                     qpchar_mask |
                     equals_char_mask>>{
                         *t.value}))
-        {
-            ec = {};
-            t.value.reset();
-            return true;
-        }
+            return false;
         return true;
     }
 };
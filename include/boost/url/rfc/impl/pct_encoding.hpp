@@ -11,6 +11,8 @@
 #define BOOST_URL_IMPL_PCT_ENCODING_HPP
 
 #include <boost/url/rfc/detail/pct_encoding.hpp>
+#include <boost/url/detail/char_table.hpp>
+#include <boost/url/detail/simd.hpp>
 
 namespace boost {
 namespace urls {
@@ -56,6 +58,53 @@ pct_decoded_size(
 
 #endif
 
+template<class CharSet>
+std::size_t
+pct_encoded_size(
+    string_view s,
+    CharSet const&) noexcept
+{
+    return detail::simd_pct_encoded_size(
+        s.data(), s.data() + s.size(),
+        detail::char_table<
+            CharSet>::nibbles);
+}
+
+template<class CharSet>
+std::size_t
+pct_encode(
+    char* first,
+    char* last,
+    string_view s,
+    CharSet const&) noexcept
+{
+    return detail::simd_pct_encode(
+        first, last, s.data(),
+        s.data() + s.size(),
+        detail::char_table<
+            CharSet>::nibbles) - first;
+}
+
+template<
+    class CharSet,
+    class Allocator>
+string_type<Allocator>
+pct_encode(
+    string_view s,
+    CharSet const& cs,
+    Allocator const& a)
+{
+    string_type<Allocator> r(a);
+    auto const n =
+        pct_encoded_size(s, cs);
+    if(n == 0)
+        return r;
+    r.resize(n);
+    pct_encode(&r[0],
+        &r[0] + n, s, cs);
+    return r;
+}
+
 } // urls
 } // boost
 
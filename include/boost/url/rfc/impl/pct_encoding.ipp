@@ -10,6 +10,9 @@
 #ifndef BOOST_URL_IMPL_PCT_ENCODING_IPP
 #define BOOST_URL_IMPL_PCT_ENCODING_IPP
 
+#include <boost/url/detail/simd.hpp>
+#include <algorithm>
+
 namespace boost {
 namespace urls {
 
@@ -17,23 +20,11 @@ std::size_t
 pct_decoded_size_unchecked(
     string_view s) noexcept
 {
-    std::size_t n = 0;
-    auto it = s.data();
-    auto const end =
-        it + s.size();
-    while(it != end)
-    {
-        auto c = *it;
-        if(c != '%')
-        {
-            ++it;
-            ++n;
-            continue;
-        }
-        it += 3;
-        ++n;
-    }
-    return n;
+    // each escape is three characters
+    // which decode to one
+    return s.size() - 2 * static_cast<
+        std::size_t>(std::count(
+            s.begin(), s.end(), '%'));
 }
 
 void
@@ -42,29 +33,21 @@ pct_decode_unchecked(
     char* const last,
     string_view s) noexcept
 {
-    auto it = s.data();
+    // the vector kernels use all of the
+    // output range as scratch, so bound
+    // it by the decoded size to keep the
+    // rest of the caller's buffer intact
+    auto const n =
+        pct_decoded_size_unchecked(s);
+    BOOST_ASSERT(n <= static_cast<
+        std::size_t>(last - out));
+    (void)last;
     auto const end =
-        it + s.size();
-    while(it != end)
-    {
-        BOOST_ASSERT(out != last);
-        if(*it != '%')
-        {
-            *out++ = *it++;
-            continue;
-        }
-        BOOST_ASSERT(end - it >= 3);
-        BOOST_ASSERT(
-            bnf::hexdig_value(it[1]) >= 0);
-        BOOST_ASSERT(
-            bnf::hexdig_value(it[2]) >= 0);
-        *out++ = static_cast<char>(
-            (static_cast<unsigned char>(
-                bnf::hexdig_value(it[1])) << 4) +
-            static_cast<unsigned char>(
-                bnf::hexdig_value(it[2])));
-        it += 3;
-    }
+        detail::simd_pct_decode(
+            out, out + n, s.data(),
+            s.data() + s.size());
+    BOOST_ASSERT(end == out + n);
+    (void)end;
 }
 
 } // urls
@@ -12,6 +12,7 @@
 
 #include <boost/url/rfc/relative_ref_bnf.hpp>
 #include <boost/url/bnf/parse.hpp>
+#include <boost/url/detail/dfa.hpp>
 #include <boost/url/rfc/fragment_bnf.hpp>
 #include <boost/url/rfc/query_bnf.hpp>
 #include <boost/url/rfc/relative_part_bnf.hpp>
@@ -69,6 +70,14 @@ parse(
     return true;
 }
 
+bool
+is_valid_relative_ref(
+    string_view s) noexcept
+{
+    return detail::match_dfa(
+        s, detail::dfa::relative_ref);
+}
+
 } // urls
 } // boost
 
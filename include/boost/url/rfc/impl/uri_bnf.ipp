@@ -12,6 +12,7 @@
 
 #include <boost/url/rfc/uri_bnf.hpp>
 #include <boost/url/bnf/parse.hpp>
+#include <boost/url/detail/dfa.hpp>
 #include <boost/url/rfc/fragment_bnf.hpp>
 #include <boost/url/rfc/hier_part_bnf.hpp>
 #include <boost/url/rfc/query_bnf.hpp>
@@ -75,6 +76,14 @@ parse(
     return true;
 }
 
+bool
+is_valid_uri(
+    string_view s) noexcept
+{
+    return detail::match_dfa(
+        s, detail::dfa::uri);
+}
+
 } // urls
 } // boost
 
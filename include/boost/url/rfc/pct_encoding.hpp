@@ -54,6 +54,9 @@ pct_decoded_size_unchecked(
     @li `s` is a valid encoded string
     @li The output range has space for the decoded string
 
+    Characters in the output range past the
+    end of the decoded string are not modified.
+
     @see
         @ref pct_decoded_size
 */
@@ -66,8 +69,12 @@ pct_decode_unchecked(
 
 /** Return a percent-decoded string, without error checking
 
+    The string is allocated once, at its final
+    size, and decoded in a single pass.
+
     @par Preconditions
-    `es` is a valid encoded string
+    @li `es` is a valid encoded string
+    @li `decoded_size == pct_decoded_size_unchecked(es)`
 */
 template<class Allocator =
     std::allocator<char>>
@@ -77,8 +84,8 @@ pct_decode_unchecked(
     std::size_t decoded_size,
     Allocator const& a = {})
 {
-// VFALCO FIX ME
-decoded_size = pct_decoded_size_unchecked(es);
+    BOOST_ASSERT(decoded_size ==
+        pct_decoded_size_unchecked(es));
     string_type<Allocator> s(a);
     if(decoded_size == 0)
         return s;
@@ -88,6 +95,77 @@ decoded_size = pct_decoded_size_unchecked(es);
     return s;
 }
 
+/** Return the size of a string after percent-encoding
+
+    Characters in `cs` are counted as one, and
+    every other character counts as three, for
+    its escape.
+
+    @param s The string to measure. This string
+    may contain any characters, including nulls.
+
+    @param cs The set of characters which do not
+    need escaping. Characters above 0x7f are
+    always escaped.
+
+    @see
+        @ref pct_encode
+*/
+template<class CharSet>
+std::size_t
+pct_encoded_size(
+    string_view s,
+    CharSet const& cs = {}) noexcept;
+
+/** Write string s with percent-encoding applied, to the range first, last
+
+    Characters not in `cs` are written as an
+    escape, with upper case hexadecimal digits.
+
+    @par Preconditions
+    `last - first >= pct_encoded_size(s, cs)`.
+    Characters in the range after the encoded
+    string may be overwritten.
+
+    @return The number of characters written.
+
+    @param s The string to encode. This string
+    may contain any characters, including nulls.
+
+    @param cs The set of characters which do not
+    need escaping.
+
+    @see
+        @ref pct_encoded_size
+*/
+template<class CharSet>
+std::size_t
+pct_encode(
+    char* first,
+    char* last,
+    string_view s,
+    CharSet const& cs = {}) noexcept;
+
+/** Return a percent-encoded string
+
+    @param s The string to encode. This string
+    may contain any characters, including nulls.
+
+    @param cs The set of characters which do not
+    need escaping.
+
+    @param a The allocator to use.
+*/
+template<
+    class CharSet,
+    class Allocator =
+        std::allocator<char>>
+string_type<Allocator>
+pct_encode(
+    string_view s,
+    CharSet const& cs = {},
+    Allocator const& a = {});
+
 /** Return true if plain equals a deecoded percent-encoded string
 */
 BOOST_URL_DECL
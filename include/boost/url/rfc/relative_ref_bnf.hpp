@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error.hpp>
+#include <boost/url/bnf/parse.hpp>
 #include <boost/url/bnf/range.hpp>
 #include <boost/url/rfc/authority_bnf.hpp>
 #include <boost/url/rfc/pct_encoded_bnf.hpp>
@@ -49,6 +50,26 @@ struct relative_ref_bnf
         relative_ref_bnf& t);
 };
 
+/** Return true if a string is a relative-ref
+
+    The string is matched against the grammar
+    in a single pass, without building any of
+    the members of @ref relative_ref_bnf and without
+    allocating.
+
+    @par BNF
+    @code
+    relative-ref  = relative-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc3986#section-4.2
+*/
+BOOST_URL_DECL
+bool
+is_valid_relative_ref(
+    string_view s) noexcept;
+
 } // urls
 } // boost
 
@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/error.hpp>
+#include <boost/url/bnf/parse.hpp>
 #include <boost/url/bnf/range.hpp>
 #include <boost/url/rfc/authority_bnf.hpp>
 #include <boost/url/rfc/pct_encoded_bnf.hpp>
@@ -50,6 +51,26 @@ struct uri_bnf
         uri_bnf& t);
 };
 
+/** Return true if a string is a URI
+
+    The string is matched against the grammar
+    in a single pass, without building any of
+    the members of @ref uri_bnf and without
+    allocating.
+
+    @par BNF
+    @code
+    URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc3986#section-3
+*/
+BOOST_URL_DECL
+bool
+is_valid_uri(
+    string_view s) noexcept;
+
 } // urls
 } // boost
 
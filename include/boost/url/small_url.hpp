@@ -0,0 +1,159 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_SMALL_URL_HPP
+#define BOOST_URL_SMALL_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/storage_ptr.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+/** A modifiable URL which stores short URLs inline
+
+    This container keeps the characters of the
+    URL in a buffer of `N` characters inside
+    the object. While the URL fits, parsing,
+    copying, and modifying it do not allocate.
+    When the URL grows beyond `N` characters,
+    the characters move to storage allocated
+    from the `storage_ptr`, as with @ref url.
+
+    All of the functions of @ref url are
+    available, and a `small_url` may be
+    passed wherever a `url&` is expected.
+    Moving a `small_url` into a @ref url copies
+    the characters while they are inline; if
+    that copy fails to allocate, the `noexcept`
+    move constructor of @ref url calls
+    `std::terminate`. Use the copy constructor
+    where that is not acceptable.
+
+    @par Example
+    @code
+    small_url<128> u( "https://www.example.com/index.html" );
+    u.set_encoded_query( "page=2" ); // no allocation
+    @endcode
+
+    @tparam N The number of characters in the
+    inline buffer, excluding the null terminator.
+*/
+template<std::size_t N>
+class small_url : public url
+{
+    char buf_[N + 1];
+
+public:
+    /** Constructor
+
+        Default constructed URLs are empty.
+    */
+    small_url() noexcept
+        : url(buf_, N, storage_ptr())
+    {
+    }
+
+    /** Construct an empty URL with the specified storage
+
+        The storage is only used when the URL
+        no longer fits in the inline buffer.
+    */
+    explicit
+    small_url(
+        storage_ptr sp) noexcept
+        : url(buf_, N, std::move(sp))
+    {
+    }
+
+    /** Construct a parsed URL
+
+        @throw std::exception parse error.
+    */
+    explicit
+    small_url(
+        string_view s)
+        : small_url()
+    {
+        set_encoded_url(s);
+    }
+
+    /** Construct a parsed URL with the specified storage
+
+        @throw std::exception parse error.
+    */
+    small_url(
+        storage_ptr sp,
+        string_view s)
+        : small_url(std::move(sp))
+    {
+        set_encoded_url(s);
+    }
+
+    /** Constructor
+
+        The characters are copied to the
+        inline buffer, if they fit. The parts
+        are copied rather than parsed again.
+    */
+    small_url(
+        small_url const& u)
+        : small_url()
+    {
+        url::operator=(u);
+    }
+
+    /** Constructor
+
+        The characters are copied to the
+        inline buffer, if they fit.
+    */
+    explicit
+    small_url(
+        url const& u)
+        : small_url()
+    {
+        url::operator=(u);
+    }
+
+    /** Assignment
+
+        The characters are copied to the
+        current storage, if they fit.
+    */
+    small_url&
+    operator=(
+        small_url const& u)
+    {
+        url::operator=(u);
+        return *this;
+    }
+
+    /** Assignment
+
+        The characters are copied to the
+        current storage, if they fit.
+    */
+    small_url&
+    operator=(
+        url const& u)
+    {
+        url::operator=(u);
+        return *this;
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -25,22 +25,32 @@ in a translation unit of the program.
 // using src.hpp as their main header file
 #include <boost/url.hpp>
 
+#include <boost/url/detail/impl/buffers.ipp>
+#include <boost/url/detail/impl/dfa.ipp>
 #include <boost/url/detail/impl/except.ipp>
 #include <boost/url/detail/impl/parse.ipp>
+#include <boost/url/detail/impl/simd.ipp>
 
 #include <boost/url/impl/error.ipp>
 #include <boost/url/impl/ipv4_address.ipp>
 #include <boost/url/impl/ipv6_address.ipp>
+#include <boost/url/impl/parse_lines.ipp>
+#include <boost/url/impl/path_index.ipp>
 #include <boost/url/impl/path_view.ipp>
+#include <boost/url/impl/pct_decoded_view.ipp>
+#include <boost/url/impl/query_key_matcher.ipp>
+#include <boost/url/impl/query_params_index.ipp>
 #include <boost/url/impl/query_params_view.ipp>
+#include <boost/url/impl/request_target.ipp>
 #include <boost/url/impl/scheme.ipp>
 #include <boost/url/impl/static_pool.ipp>
 #include <boost/url/impl/url.ipp>
+#include <boost/url/impl/url_columns.ipp>
+#include <boost/url/impl/url_parser.ipp>
 #include <boost/url/impl/url_view.ipp>
 
 #include <boost/url/rfc/impl/absolute_uri_bnf.ipp>
 #include <boost/url/rfc/impl/authority_bnf.ipp>
-#include <boost/url/rfc/impl/char_sets.ipp>
 #include <boost/url/rfc/impl/fragment_bnf.ipp>
 #include <boost/url/rfc/impl/hier_part_bnf.ipp>
 #include <boost/url/rfc/impl/host_bnf.ipp>
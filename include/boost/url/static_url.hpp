@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_STATIC_URL_HPP
+#define BOOST_URL_STATIC_URL_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A modifiable URL with a fixed capacity
+
+    This container keeps the characters of the
+    URL in a buffer of `N` characters inside
+    the object, and never allocates. Unlike
+    @ref small_url there is no storage to fall
+    back on: a change which would make the URL
+    longer than `N` characters fails, and the
+    URL is left unchanged.
+
+    All of the functions of @ref url are
+    available, and a `static_url` may be passed
+    wherever a `url&` is expected. The setters,
+    and the modifiers of the container returned
+    by @ref url::path, which take an `error_code`
+    report a URL which does not fit by setting
+    it to @ref error::capacity_exceeded, and
+    never throw; the others throw @ref too_large.
+    The storage of the base @ref url is never
+    used. Moving a `static_url` into a @ref url
+    always copies the characters; if that copy
+    fails to allocate, the `noexcept` move
+    constructor of @ref url calls
+    `std::terminate`.
+
+    @par Example
+    @code
+    static_url<256> u;
+    error_code ec;
+    u.set_encoded_url( s, ec );
+    if( ! ec )
+        u.set_encoded_query( "page=2", ec );
+    @endcode
+
+    @tparam N The capacity, in characters,
+    excluding the null terminator.
+*/
+template<std::size_t N>
+class static_url : public url
+{
+    char buf_[N + 1];
+
+public:
+    /** Constructor
+
+        Default constructed URLs are empty.
+    */
+    static_url() noexcept
+        : url(buf_, N)
+    {
+    }
+
+    /** Construct a parsed URL
+
+        @throw std::exception parse error.
+
+        @throw too_large The URL does not fit.
+    */
+    explicit
+    static_url(
+        string_view s)
+        : static_url()
+    {
+        set_encoded_url(s);
+    }
+
+    /** Constructor
+    */
+    static_url(
+        static_url const& u) noexcept
+        : static_url()
+    {
+        url::operator=(u);
+    }
+
+    /** Construct a copy of a URL
+
+        @throw too_large The URL does not fit.
+    */
+    explicit
+    static_url(
+        url_view const& u)
+        : static_url()
+    {
+        set_encoded_url(u.encoded_url());
+    }
+
+    /** Assignment
+    */
+    static_url&
+    operator=(
+        static_url const& u) noexcept
+    {
+        url::operator=(u);
+        return *this;
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -14,6 +14,7 @@
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
 #include <boost/url/path_view.hpp>
+#include <boost/url/pct_decoded_view.hpp>
 #include <boost/url/query_params_view.hpp>
 #include <boost/url/detail/char_type.hpp>
 #include <boost/url/detail/parts.hpp>
@@ -56,6 +57,14 @@ class url
     storage_ptr sp_;
     std::size_t cap_ = 0;
 
+    // storage supplied by a derived
+    // class, which is never deallocated
+    char* ibuf_ = nullptr;
+    std::size_t icap_ = 0;
+
+    // true if ibuf_ is the only storage
+    bool fixed_ = false;
+
     // VFALCO This has to be kept in
     // sync with other declarations
     enum
@@ -79,6 +88,12 @@ class url
     std::size_t len(int id) const noexcept;
     std::size_t len(int id0, int id1) const noexcept;
 
+    // decoded size of a part,
+    // after setters changed it
+    BOOST_URL_DECL
+    std::size_t
+    decoded_size(int id) const noexcept;
+
 public:
     class params_type;
     class segments_type;
@@ -106,6 +121,18 @@ public:
     string_view
     encoded_url() const;
 
+    /** Return a read-only view of the URL
+
+        The view references the characters of
+        this URL, and is invalidated by any
+        change to it.
+
+        @par Exception Safety
+        No-throw guarantee.
+    */
+    BOOST_URL_DECL
+    operator url_view() const noexcept;
+
     /** Return the origin
     */
     BOOST_URL_DECL
@@ -208,8 +235,33 @@ public:
     userinfo(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_userinfo(), a);
+        return pct_decode_unchecked(
+            encoded_userinfo(),
+            decoded_size(id_user) + (
+                has_password() ? 1 +
+                decoded_size(id_pass) : 0),
+            a);
+    }
+
+    /** Return the userinfo as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see userinfo
+    */
+    pct_decoded_view
+    decoded_userinfo() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_userinfo(),
+            decoded_size(id_user) + (
+                has_password() ? 1 +
+                decoded_size(id_pass) : 0));
     }
 
     /** Return the username if it exists, or an empty string
@@ -258,8 +310,28 @@ public:
     username(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_username(), a);
+        return pct_decode_unchecked(
+            encoded_username(),
+            decoded_size(id_user), a);
+    }
+
+    /** Return the username as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see username
+    */
+    pct_decoded_view
+    decoded_username() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_username(),
+            decoded_size(id_user));
     }
 
     /** Return true if a password exists
@@ -283,8 +355,28 @@ public:
     password(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_password(), a);
+        return pct_decode_unchecked(
+            encoded_password(),
+            decoded_size(id_pass), a);
+    }
+
+    /** Return the password as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see password
+    */
+    pct_decoded_view
+    decoded_password() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_password(),
+            decoded_size(id_pass));
     }
 
     //--------------------------------------------
@@ -350,7 +442,30 @@ public:
                 s0.data(), s0.size(), a);
         }
         return pct_decode_unchecked(
-            s0, pt_.decoded[id_host], a);
+            s0, decoded_size(id_host), a);
+    }
+
+    /** Return the host as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see host
+    */
+    pct_decoded_view
+    decoded_host() const noexcept
+    {
+        auto const s0 =
+            encoded_host();
+        if(pt_.host_type !=
+            urls::host_type::name)
+            return pct_decoded_view(s0);
+        return pct_decoded_view(
+            s0, decoded_size(id_host));
     }
 
     /** Return the ipv4 address if it exists, or return the unspecified address (0.0.0.0)
@@ -509,8 +624,28 @@ public:
     query(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_query(), a);
+        return pct_decode_unchecked(
+            encoded_query(),
+            decoded_size(id_query), a);
+    }
+
+    /** Return the query as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see query
+    */
+    pct_decoded_view
+    decoded_query() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_query(),
+            decoded_size(id_query));
     }
 
     /** Return the query parameters as a read-only forward range
@@ -597,7 +732,26 @@ public:
     {
         return pct_decode_unchecked(
             encoded_fragment(),
-            pt_.decoded[id_frag], a);
+            decoded_size(id_frag), a);
+    }
+
+    /** Return the fragment as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see fragment
+    */
+    pct_decoded_view
+    decoded_fragment() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_fragment(),
+            decoded_size(id_frag));
     }
 
     //--------------------------------------------
@@ -612,6 +766,80 @@ public:
     BOOST_URL_DECL
     url() noexcept;
 
+    /** Constructor
+
+        The new URL uses the storage of `u`, and
+        its contents are a copy of `u`. The parts
+        of `u` are copied rather than parsed again.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    url(url const& u);
+
+    /** Constructor
+
+        The new URL uses the storage of `u`. If
+        the characters of `u` were allocated from
+        that storage, ownership of them is
+        transferred and no allocation takes place.
+        Otherwise, `u` keeps its characters in a
+        buffer supplied by a derived class such as
+        @ref small_url, and they are copied.
+
+        After the move, `u` is empty.
+
+        @par Exception Safety
+
+        No-throw guarantee. A failure to allocate
+        while copying from a buffer supplied by a
+        derived class calls `std::terminate`.
+    */
+    BOOST_URL_DECL
+    url(url&& u) noexcept;
+
+    /** Assignment
+
+        The contents become a copy of `u`, reusing
+        the existing storage when the capacity is
+        sufficient. The storage is not changed.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    url&
+    operator=(url const& u);
+
+    /** Assignment
+
+        If the storage of `u` is equal to the
+        storage of this URL, and the characters of
+        `u` were allocated from it, ownership of
+        them is transferred, `u` becomes empty, and
+        no allocation takes place. Otherwise the
+        contents of `u` are copied, as if by copy
+        assignment. The storage is not changed.
+
+        This function is not `noexcept`, because
+        the copy made when the storages differ, or
+        when `u` keeps its characters in a buffer
+        supplied by a derived class, may allocate.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    url&
+    operator=(url&& u);
+
     /** Construct an empty URL with the specified storage.
     */
     explicit
@@ -644,6 +872,62 @@ public:
     {
     }
 
+protected:
+    /** Construct an empty URL using a buffer for its characters
+
+        The characters are kept in `buf` for
+        as long as they fit. When the URL
+        outgrows it, storage is allocated from
+        `sp` instead; shrinking to fit may move
+        the characters back.
+
+        The buffer is not owned. It is intended
+        to be a member of the derived class.
+
+        @param buf A buffer of `cap + 1`
+        characters, including the null
+        terminator.
+
+        @param cap The number of characters,
+        excluding the null terminator, which
+        fit in `buf`.
+
+        @param sp The storage to use when
+        the buffer is too small.
+
+        @see small_url
+    */
+    BOOST_URL_DECL
+    url(
+        char* buf,
+        std::size_t cap,
+        storage_ptr sp) noexcept;
+
+    /** Construct an empty URL using a fixed buffer for its characters
+
+        The characters are always kept in `buf`
+        and nothing is ever allocated. A change
+        which would not fit fails instead: the
+        functions which take an `error_code`
+        set it to @ref error::capacity_exceeded,
+        and the others throw @ref too_large.
+
+        @param buf A buffer of `cap + 1`
+        characters, including the null
+        terminator.
+
+        @param cap The number of characters,
+        excluding the null terminator, which
+        fit in `buf`.
+
+        @see static_url
+    */
+    BOOST_URL_DECL
+    url(
+        char* buf,
+        std::size_t cap) noexcept;
+
+public:
     /** Return the number of characters in the URL
     */
     // VFALCO do we need this?
@@ -664,6 +948,48 @@ public:
         return cap_;
     }
 
+    /** Increase the capacity to at least a number of characters
+
+        If `n` is greater than the current
+        capacity, new storage is allocated and
+        the characters are moved to it. Otherwise,
+        this function has no effect.
+
+        Reserving up front lets a URL be built
+        with a sequence of setters without any
+        further allocation.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The number of characters, not
+        including the null terminator.
+    */
+    BOOST_URL_DECL
+    void
+    reserve(std::size_t n);
+
+    /** Reduce the capacity to the size of the URL
+
+        If the capacity is greater than the size,
+        the characters are moved to new storage
+        that holds exactly the URL. An empty URL
+        releases its storage. A URL constructed
+        with a buffer moves back into it when
+        the characters fit, and this function
+        has no effect while they are in it.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+    */
+    BOOST_URL_DECL
+    void
+    shrink_to_fit();
+
     /** Clear the contents.
     
         @par Exception Safety
@@ -693,6 +1019,74 @@ public:
     set_encoded_url(
         string_view s);
 
+    /** Set the URL.
+
+        If `s` is not a valid <em>URI-reference</em>,
+        or if the URL has fixed storage which is
+        too small to hold it, the error is set in
+        `ec` and the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The URL to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_url(
+        string_view s,
+        error_code& ec);
+
+    /** Set the URL to a copy of a view
+
+        The characters of `v` are copied into
+        the existing storage, which is reused
+        when the capacity is sufficient. The
+        parts already found when `v` was parsed
+        are copied with them, so the URL is not
+        parsed again.
+
+        The view must hold a <em>URI-reference</em>,
+        in which any authority is introduced by
+        a double slash ("//"). The views returned
+        by @ref parse_uri and the other functions
+        which parse URLs meet this requirement,
+        while the authority-form returned by
+        @ref parse_request_target does not.
+
+        @par Example
+        @code
+        url u;
+        for(;;)
+        {
+            // one scan, and no allocation once
+            // u has grown to fit the longest URL
+            u.assign( parse_uri( next_target() ) );
+            ...
+        }
+        @endcode
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw too_large The URL has fixed
+        storage which is too small.
+
+        @throw invalid_part `v` has an authority
+        which is not introduced by "//".
+    */
+    BOOST_URL_DECL
+    url&
+    assign(url_view const& v);
+
     /** Set the origin to the specified value.
 
         The origin consists of the everything from the
@@ -706,13 +1100,40 @@ public:
 
         @param s The origin to set. Special characters
         must be percent-encoded, or an exception is
-        thrown.
+        thrown. A trailing "/" is accepted and
+        ignored; any other path, or a query or
+        fragment, is an error.
+
+        @throw invalid_part `s` is not a valid origin.
     */
     BOOST_URL_DECL
     url&
     set_encoded_origin(
         string_view s);
 
+    /** Set the origin.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The origin to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_origin(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // scheme
@@ -752,6 +1173,29 @@ public:
     url&
     set_scheme(string_view s);
 
+    /** Set the scheme.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The scheme to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_scheme(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // authority
@@ -777,6 +1221,29 @@ public:
     set_encoded_authority(
         string_view s);
 
+    /** Set the authority.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The authority to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_authority(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // userinfo
@@ -822,6 +1289,29 @@ public:
     set_encoded_userinfo(
         string_view s);
 
+    /** Set the userinfo.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The userinfo to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_userinfo(
+        string_view s,
+        error_code& ec);
+
     /** Set the userinfo.
 
         Sets the userinfo of the URL to the given
@@ -861,6 +1351,29 @@ public:
     set_userinfo_part(
         string_view s);
 
+    /** Set the userinfo.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The userinfo to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_userinfo_part(
+        string_view s,
+        error_code& ec);
+
     /** Set the user.
 
         The user is set to the specified string,
@@ -889,6 +1402,29 @@ public:
     set_user(
         string_view s);
 
+    /** Set the user.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The user to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_user(
+        string_view s,
+        error_code& ec);
+
     /** Set the user.
 
         The user is set to the specified encoded
@@ -923,6 +1459,29 @@ public:
     set_encoded_user(
         string_view s);
 
+    /** Set the user.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The user to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_user(
+        string_view s,
+        error_code& ec);
+
     /** Set the password.
 
         This function sets the password to the specified
@@ -953,6 +1512,29 @@ public:
     set_password(
         string_view s);
 
+    /** Set the password.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The password to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_password(
+        string_view s,
+        error_code& ec);
+
     /** Set the password.
 
         The password is set to the encoded string `s`,
@@ -988,6 +1570,29 @@ public:
     set_encoded_password(
         string_view s);
 
+    /** Set the password.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The password to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_password(
+        string_view s,
+        error_code& ec);
+
     /** Set the password.
 
         The password part is set to the encoded string
@@ -1024,6 +1629,29 @@ public:
     set_password_part(
         string_view s);
 
+    /** Set the password.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The password to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_password_part(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // host
@@ -1095,6 +1723,29 @@ public:
     set_host(
         string_view s);
 
+    /** Set the host.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The host to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_host(
+        string_view s,
+        error_code& ec);
+
     /** Set the host.
 
         The host is set to the specified encoded string,
@@ -1151,26 +1802,72 @@ public:
     set_encoded_host(
         string_view s);
 
+    /** Set the host.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The host to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_host(
+        string_view s,
+        error_code& ec);
+
     /** Set the port.
 
         The port of the URL is set to the specified
         integer, replacing any previous port.
 
-        If the URL previously did not contain an
-        authority (@ref has_authority returns `false`),
-        then the authority is added including the
-        leading double slash ("//").
+        If the URL previously did not contain an
+        authority (@ref has_authority returns `false`),
+        then the authority is added including the
+        leading double slash ("//").
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The port number to set.
+    */
+    BOOST_URL_DECL
+    url&
+    set_port(unsigned n);
+
+    /** Set the port.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
 
         @par Exception Safety
 
         Strong guarantee.
         Calls to allocate may throw.
+        URLs with fixed storage do not throw.
 
         @param n The port number to set.
+
+        @param ec Set to the error, if any
+        occurred.
     */
     BOOST_URL_DECL
     url&
-    set_port(unsigned n);
+    set_port(
+        unsigned n,
+        error_code& ec);
 
     /** Set the port.
 
@@ -1209,6 +1906,29 @@ public:
     url&
     set_port(string_view s);
 
+    /** Set the port.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The port to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_port(
+        string_view s,
+        error_code& ec);
+
     /** Set the port.
 
         The port of the URL is set to the specified string.
@@ -1246,12 +1966,95 @@ public:
     url&
     set_port_part(string_view s);
 
+    /** Set the port.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The port to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_port_part(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // path
     //
     //------------------------------------------------------
 
+    /** Set the path.
+
+        Sets the path of the URL to the specified
+        plain string. If this string is empty,
+        any existing path is removed. Slashes
+        ('/') separate segments; any other special
+        or reserved characters are automatically
+        percent-encoded. When there is no scheme
+        and the path is relative, colons (':') in
+        the first segment are encoded as well.
+
+        The string must still have the shape of
+        a path for the existing contents of the
+        URL:
+
+        @li If an authority is present (@ref has_authority
+        returns `true`), a non-empty path must start
+        with a forward slash ('/'), else
+
+        @li The path may not start with two slashes.
+
+        Otherwise an exception is thrown.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param s The string to set.
+
+        @throws std::exception invalid path.
+    */
+    BOOST_URL_DECL
+    url&
+    set_path(
+        string_view s);
+
+    /** Set the path.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The path to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_path(
+        string_view s,
+        error_code& ec);
+
     /** Set the path.
 
         Sets the path of the URL to the specified
@@ -1308,6 +2111,29 @@ public:
     set_encoded_path(
         string_view s);
 
+    /** Set the path.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The path to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_path(
+        string_view s,
+        error_code& ec);
+
     /** Return the path.
 
         This function returns the path segments
@@ -1359,6 +2185,29 @@ public:
     set_query(
         string_view s);
 
+    /** Set the query.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The query to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_query(
+        string_view s,
+        error_code& ec);
+
     /** Set the query.
 
         Sets the query of the URL to the specified
@@ -1394,6 +2243,29 @@ public:
     set_encoded_query(
         string_view s);
 
+    /** Set the query.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The query to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_query(
+        string_view s,
+        error_code& ec);
+
     /** Set the query.
 
         Sets the query of the URL to the specified
@@ -1428,6 +2300,29 @@ public:
     set_query_part(
         string_view s);
 
+    /** Set the query.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The query to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_query_part(
+        string_view s,
+        error_code& ec);
+
     /** Return the query.
 
         This function returns the query parameters
@@ -1479,6 +2374,29 @@ public:
     set_fragment(
         string_view s);
 
+    /** Set the fragment.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The fragment to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_fragment(
+        string_view s,
+        error_code& ec);
+
     /** Set the fragment.
 
         Sets the fragment of the URL to the specified
@@ -1516,6 +2434,29 @@ public:
     set_encoded_fragment(
         string_view s);
 
+    /** Set the fragment.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The fragment to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_encoded_fragment(
+        string_view s,
+        error_code& ec);
+
     /** Set the fragment.
 
         Sets the fragment of the URL to the specified
@@ -1552,6 +2493,29 @@ public:
     set_fragment_part(
         string_view s);
 
+    /** Set the fragment.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+
+        @param s The fragment to set.
+
+        @param ec Set to the error, if any
+        occurred.
+    */
+    BOOST_URL_DECL
+    url&
+    set_fragment_part(
+        string_view s,
+        error_code& ec);
+
     //------------------------------------------------------
     //
     // normalization
@@ -1569,16 +2533,82 @@ public:
     normalize_scheme() noexcept;
 
 private:
+    BOOST_URL_DECL
+    friend
+    void
+    parse_uri(
+        string_view s,
+        url& u,
+        error_code& ec);
+
+    inline void reset_impl() noexcept;
+    inline void assign_impl(
+        string_view s,
+        detail::parts const& pt);
+    inline std::size_t growth(
+        std::size_t new_size) const noexcept;
+    inline void reserve_impl(
+        std::size_t new_cap);
+    inline void reserve_impl(
+        std::size_t new_cap, error_code& ec);
     inline void resize_impl(
-        std::size_t new_size);
+        std::size_t new_size, error_code& ec);
     inline char* resize_impl(
-        int id, std::size_t new_size);
+        int id, std::size_t new_size,
+        error_code& ec);
     inline char* resize_impl(
-        int first, int last, std::size_t new_size);
+        int first, int last, std::size_t new_size,
+        error_code& ec);
 };
 
 //----------------------------------------------------------
 
+/** Parse a URI into an existing URL
+
+    The string is parsed once, and its characters
+    are copied into the existing storage of `u`,
+    which is reused when the capacity is sufficient.
+    On error, `u` is unchanged. If `u` has fixed
+    storage which is too small, `ec` is set to
+    @ref error::capacity_exceeded.
+
+    @par BNF
+    @code
+    URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+    @endcode
+
+    @par Exception Safety
+
+    Strong guarantee.
+    Calls to allocate may throw.
+
+    @see
+        https://datatracker.ietf.org/doc/html/rfc3986#section-3
+*/
+BOOST_URL_DECL
+void
+parse_uri(
+    string_view s,
+    url& u,
+    error_code& ec);
+
+/** Parse a URI into an existing URL
+
+    @throw std::exception parse error.
+
+    @throw too_large `u` has fixed storage
+    which is too small.
+
+    @see parse_uri(string_view, url&, error_code&)
+*/
+BOOST_URL_DECL
+void
+parse_uri(
+    string_view s,
+    url& u);
+
+//----------------------------------------------------------
+
 /** A read/write view to the path segments.
 */
 class url::segments_type
@@ -1594,12 +2624,20 @@ private:
     BOOST_URL_DECL
     iterator
     insert_encoded_impl(
-        iterator pos, string_view s );
+        iterator pos, string_view s,
+        error_code& ec );
 
     BOOST_URL_DECL
     iterator
     insert_impl(
-        iterator pos, string_view s, std::size_t ns );
+        iterator pos, string_view s, std::size_t ns,
+        error_code& ec );
+
+    BOOST_URL_DECL
+    void
+    reserve_replace(
+        iterator pos, std::size_t n,
+        error_code& ec );
 
 public:
     segments_type() = delete;
@@ -1635,6 +2673,26 @@ public:
     iterator
     end() const noexcept;
 
+    /** Return the first segment
+
+        @par Preconditions
+        `! empty()`
+    */
+    BOOST_URL_DECL
+    value_type
+    front() const noexcept;
+
+    /** Return the last segment
+
+        Only the last segment is scanned.
+
+        @par Preconditions
+        `! empty()`
+    */
+    BOOST_URL_DECL
+    value_type
+    back() const noexcept;
+
     /** Erase the specified sequence of path segments.
 
         @par Exception Safety
@@ -1678,6 +2736,23 @@ public:
     iterator
     insert_encoded( iterator pos, string_view s );
 
+    /** Insert an encoded path segment at the specified position.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged and `pos`
+        is returned.
+
+        @par Exception Safety
+
+        Strong guarantee. Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+    */
+    BOOST_URL_DECL
+    iterator
+    insert_encoded( iterator pos, string_view s,
+        error_code& ec );
+
     /** Encode an unencoded path segment and insert it at the specified position.
 
         @par Exception Safety
@@ -1692,6 +2767,23 @@ public:
     iterator
     insert( iterator pos, string_view s );
 
+    /** Encode an unencoded path segment and insert it at the specified position.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged and `pos`
+        is returned.
+
+        @par Exception Safety
+
+        Strong guarantee. Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+    */
+    BOOST_URL_DECL
+    iterator
+    insert( iterator pos, string_view s,
+        error_code& ec );
+
     /** Replace the path segment at the specified position with the specified encoded path segment.
 
         @par Exception Safety
@@ -1706,6 +2798,23 @@ public:
     iterator
     replace_encoded( iterator pos, string_view s );
 
+    /** Replace the path segment at the specified position with the specified encoded path segment.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged and `pos`
+        is returned.
+
+        @par Exception Safety
+
+        Strong guarantee. Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+    */
+    BOOST_URL_DECL
+    iterator
+    replace_encoded( iterator pos, string_view s,
+        error_code& ec );
+
     /** Replace the path segment at the specified position with the specified unencoded path segment.
 
         @par Exception Safety
@@ -1719,6 +2828,23 @@ public:
     BOOST_URL_DECL
     iterator
     replace( iterator pos, string_view s );
+
+    /** Replace the path segment at the specified position with the specified unencoded path segment.
+
+        Behaves as the overload above, except
+        that errors are reported through `ec`.
+        On error, the URL is unchanged and `pos`
+        is returned.
+
+        @par Exception Safety
+
+        Strong guarantee. Calls to allocate may throw.
+        URLs with fixed storage do not throw.
+    */
+    BOOST_URL_DECL
+    iterator
+    replace( iterator pos, string_view s,
+        error_code& ec );
 };
 
 //----------------------------------------------------------
@@ -1726,13 +2852,15 @@ public:
 class url::segments_type::value_type
 {
     string_view s_;
+    std::size_t n_;
 
     friend class segments_type;
 
-    explicit
     value_type(
-        string_view s) noexcept
+        string_view s,
+        std::size_t decoded_size) noexcept
         : s_(s)
+        , n_(decoded_size)
     {
     }
 
@@ -1771,8 +2899,20 @@ public:
     string_type<Allocator>
     string(Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_string(), a);
+        return pct_decode_unchecked(
+            s_, n_, a);
+    }
+
+    /** Return the segment as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_string() const noexcept
+    {
+        return pct_decoded_view(
+            s_, n_);
     }
 
     value_type const*
@@ -1791,6 +2931,7 @@ class url::segments_type::iterator
     url* v_;
     std::size_t off_;
     std::size_t n_;
+    std::size_t dn_;
 
     BOOST_URL_DECL
     iterator(
@@ -1963,14 +3104,20 @@ class url::params_type::value_type
 {
     string_view k_;
     string_view v_;
+    std::size_t dk_;
+    std::size_t dv_;
 
     friend class params_type;
 
     value_type(
         string_view k,
-        string_view v) noexcept
+        std::size_t dk,
+        string_view v,
+        std::size_t dv) noexcept
         : k_(k)
         , v_(v)
+        , dk_(dk)
+        , dv_(dv)
     {
     }
 
@@ -2015,8 +3162,8 @@ public:
     string_type<Allocator>
     key(Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_key(), a);
+        return pct_decode_unchecked(
+            k_, dk_, a);
     }
 
     /** Return the value.
@@ -2040,8 +3187,32 @@ public:
     string_type<Allocator>
     value(Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_value(), a);
+        return pct_decode_unchecked(
+            v_, dv_, a);
+    }
+
+    /** Return the key as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_key() const noexcept
+    {
+        return pct_decoded_view(
+            k_, dk_);
+    }
+
+    /** Return the value as a percent-decoded view
+
+        Characters are decoded as they are
+        visited, without allocating.
+    */
+    pct_decoded_view
+    decoded_value() const noexcept
+    {
+        return pct_decoded_view(
+            v_, dv_);
     }
 
     value_type const*
@@ -2069,6 +3240,8 @@ class url::params_type::iterator
     std::size_t off_;
     std::size_t nk_;
     std::size_t nv_;
+    std::size_t dk_;
+    std::size_t dv_;
 
     BOOST_URL_DECL
     iterator(
@@ -0,0 +1,275 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_URL_COLUMNS_HPP
+#define BOOST_URL_URL_COLUMNS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/parts.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** The results of parsing many URLs, stored by component
+
+    Each appended string becomes a row, and
+    each row is spread across parallel arrays,
+    one for every value produced by the parser:
+    the end offset of each component, its
+    decoded size, the segment and parameter
+    counts, the port number, the host type, and
+    the error code. Code which only looks at one
+    component of many URLs touches only the
+    arrays for that component.
+
+    Like @ref url_view, the rows reference the
+    characters of the strings passed in, which
+    must remain valid for as long as the rows
+    are used.
+
+    @par Example
+    @code
+    url_columns c;
+    c.append_uri( lines.data(), lines.size() );
+    for( std::size_t i = 0; i < c.size(); ++i )
+        if( ! c.error( i ) )
+            ++hits[ c.encoded_host( i ) ];
+    @endcode
+*/
+class url_columns
+{
+    enum
+    {
+        id_scheme = detail::id_scheme,
+        id_user = detail::id_user,
+        id_pass = detail::id_pass,
+        id_host = detail::id_host,
+        id_port = detail::id_port,
+        id_path = detail::id_path,
+        id_query = detail::id_query,
+        id_frag = detail::id_frag,
+        id_end = detail::id_end
+    };
+
+    // end_[id][i] is the offset one past
+    // the end of component id in row i
+    std::vector<char const*> s_;
+    std::vector<std::size_t> end_[id_end];
+    std::vector<std::size_t> decoded_[id_end];
+    std::vector<std::size_t> nseg_;
+    std::vector<std::size_t> nparam_;
+    std::vector<std::uint16_t> port_;
+    std::vector<urls::host_type> host_type_;
+    std::vector<unsigned char> ip_;
+    std::vector<error_code> ec_;
+
+    std::size_t
+    begin_of(
+        int id,
+        std::size_t i) const noexcept
+    {
+        return id == id_scheme ?
+            0 : end_[id - 1][i];
+    }
+
+    string_view
+    get(int id,
+        std::size_t i) const noexcept
+    {
+        auto const b = begin_of(id, i);
+        return string_view(s_[i] + b,
+            end_[id][i] - b);
+    }
+
+    void
+    push(
+        char const* s,
+        detail::parts const& pt,
+        error_code const& ec);
+
+    std::size_t
+    append(
+        string_view const* s,
+        std::size_t n,
+        bool relative);
+
+public:
+    /** Constructor
+
+        Default constructed columns have no rows.
+    */
+    url_columns() = default;
+
+    /** Return true if there are no rows
+    */
+    bool
+    empty() const noexcept
+    {
+        return s_.empty();
+    }
+
+    /** Return the number of rows
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return s_.size();
+    }
+
+    /** Remove all rows
+
+        Capacity is retained.
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Reserve space for at least `n` rows
+    */
+    BOOST_URL_DECL
+    void
+    reserve(std::size_t n);
+
+    /** Parse and append a sequence of URIs
+
+        Each of the `n` strings starting at `s`
+        is parsed as a URI and appended as a row.
+        Strings which fail to parse produce a row
+        with the error set and every component
+        empty.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The number of strings which
+        failed to parse.
+
+        @see parse_uri
+    */
+    BOOST_URL_DECL
+    std::size_t
+    append_uri(
+        string_view const* s,
+        std::size_t n);
+
+    /** Parse and append a sequence of relative-refs
+
+        Each of the `n` strings starting at `s`
+        is parsed as a relative-ref and appended
+        as a row. Strings which fail to parse
+        produce a row with the error set and
+        every component empty.
+
+        @par Exception Safety
+
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return The number of strings which
+        failed to parse.
+
+        @see parse_relative_ref
+    */
+    BOOST_URL_DECL
+    std::size_t
+    append_relative_ref(
+        string_view const* s,
+        std::size_t n);
+
+    /** Return the result of parsing row `i`
+    */
+    error_code
+    error(std::size_t i) const noexcept
+    {
+        return ec_[i];
+    }
+
+    /** Return row `i` as a view
+    */
+    BOOST_URL_DECL
+    url_view
+    operator[](std::size_t i) const noexcept;
+
+    /** Return the scheme of row `i`
+
+        @see url_view::scheme
+    */
+    BOOST_URL_DECL
+    string_view
+    scheme(std::size_t i) const noexcept;
+
+    /** Return the host of row `i`
+
+        @see url_view::encoded_host
+    */
+    string_view
+    encoded_host(std::size_t i) const noexcept
+    {
+        return get(id_host, i);
+    }
+
+    /** Return the host type of row `i`
+
+        @see url_view::host_type
+    */
+    urls::host_type
+    host_type(std::size_t i) const noexcept
+    {
+        return host_type_[i];
+    }
+
+    /** Return the port number of row `i`
+
+        @see url_view::port_number
+    */
+    std::uint16_t
+    port_number(std::size_t i) const noexcept
+    {
+        return port_[i];
+    }
+
+    /** Return the path of row `i`
+
+        @see url_view::encoded_path
+    */
+    string_view
+    encoded_path(std::size_t i) const noexcept
+    {
+        return get(id_path, i);
+    }
+
+    /** Return the query of row `i`
+
+        @see url_view::encoded_query
+    */
+    BOOST_URL_DECL
+    string_view
+    encoded_query(std::size_t i) const noexcept;
+
+    /** Return the fragment of row `i`
+
+        @see url_view::encoded_fragment
+    */
+    BOOST_URL_DECL
+    string_view
+    encoded_fragment(std::size_t i) const noexcept;
+};
+
+} // urls
+} // boost
+
+#endif
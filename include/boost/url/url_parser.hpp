@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_URL_PARSER_HPP
+#define BOOST_URL_URL_PARSER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/string.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/dfa.hpp>
+#include <boost/url/detail/parts.hpp>
+
+namespace boost {
+namespace urls {
+
+/** A resumable parser for URLs arriving in pieces
+
+    Input is presented in any number of calls
+    to @ref write, followed by a call to
+    @ref finish. The parser keeps its position
+    in the grammar between calls, so each
+    character is examined exactly once no
+    matter where the input is split, including
+    inside a percent-escape, an IP-literal,
+    or a port.
+
+    The parser does not keep the characters.
+    Once parsing is complete, the result is
+    obtained by calling @ref result with the
+    complete input laid out contiguously.
+
+    @par Example
+    @code
+    url_parser pr;
+    std::string s;
+    error_code ec;
+    while( ! pr.is_done() )
+    {
+        auto const b = read_some( sock );
+        s.append( b.data(), b.size() );
+        if( b.empty() )
+            pr.finish( ec );
+        else
+            pr.write( b, ec );
+        if( ec )
+            return;
+    }
+    url_view u = pr.result( s.data() );
+    @endcode
+*/
+class url_parser
+{
+    detail::dfa d_;
+    bool done_ = false;
+
+public:
+    /** The grammar to match
+    */
+    enum grammar
+    {
+        /// URI
+        uri = detail::dfa::uri,
+
+        /// relative-ref
+        relative_ref = detail::dfa::relative_ref,
+
+        /// URI-reference
+        uri_reference = detail::dfa::uri_reference
+    };
+
+    /** Constructor
+
+        @param g The grammar to match.
+    */
+    explicit
+    url_parser(
+        grammar g = uri) noexcept
+        : d_(static_cast<
+            detail::dfa::kind>(g))
+    {
+    }
+
+    /** Return true if parsing is complete
+
+        This is true after a successful
+        call to @ref finish.
+    */
+    bool
+    is_done() const noexcept
+    {
+        return done_;
+    }
+
+    /** Return the number of characters consumed
+
+        After an error, this is the offset
+        of the first invalid character.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return d_.pos();
+    }
+
+    /** Parse the next piece of input
+
+        @return The number of characters
+        consumed. This is less than `s.size()`
+        only if an error occurred.
+
+        @param s The input.
+
+        @param ec Set to the error, if any.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    write(
+        string_view s,
+        error_code& ec) noexcept;
+
+    /** Parse the next piece of input
+
+        @return The number of characters
+        consumed, which is always `s.size()`.
+
+        @param s The input.
+
+        @throw system_error The input is invalid.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    write(string_view s);
+
+    /** Indicate the end of the input
+
+        @param ec Set to the error, if any.
+    */
+    BOOST_URL_DECL
+    void
+    finish(error_code& ec) noexcept;
+
+    /** Indicate the end of the input
+
+        @throw system_error The input is invalid.
+    */
+    BOOST_URL_DECL
+    void
+    finish();
+
+    /** Return the offsets of each part
+
+        The offsets are relative to the
+        first character of input, in the
+        same form used by @ref url_view.
+
+        @par Preconditions
+        @code
+        this->is_done()
+        @endcode
+    */
+    detail::parts const&
+    parts() const noexcept
+    {
+        BOOST_ASSERT(done_);
+        return d_.get();
+    }
+
+    /** Return a view of the parsed URL
+
+        @par Preconditions
+        @code
+        this->is_done()
+        @endcode
+
+        @param s A pointer to the complete
+        input, which must remain valid for
+        the lifetime of the returned view.
+    */
+    url_view
+    result(char const* s) const noexcept
+    {
+        BOOST_ASSERT(done_);
+        return url_view(s, d_.get());
+    }
+};
+
+} // urls
+} // boost
+
+#endif
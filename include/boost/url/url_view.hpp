@@ -14,6 +14,7 @@
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
 #include <boost/url/path_view.hpp>
+#include <boost/url/pct_decoded_view.hpp>
 #include <boost/url/query_params_view.hpp>
 #include <boost/url/detail/char_type.hpp>
 #include <boost/url/detail/parts.hpp>
@@ -26,6 +27,10 @@
 namespace boost {
 namespace urls {
 
+#ifndef BOOST_URL_DOCS
+enum class target_form;
+#endif
+
 /** A parsed reference to a URL string.
 */
 class url_view
@@ -49,6 +54,8 @@ class url_view
     };
 
     friend class url;
+    friend class url_columns;
+    friend class url_parser;
     struct shared_impl;
 
     // shortcuts
@@ -165,7 +172,10 @@ public:
         present, even if the authority is an empty
         string. Its presence
         in a URL is determined by a leading double-slash
-        ("//") in the 
+        ("//") in the hier-part or relative-part. The
+        authority-form of a request-target is only an
+        authority, and has no double-slash.
+
         @par Exception Safety
         No-throw guarantee.
     */
@@ -231,8 +241,33 @@ public:
     userinfo(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_userinfo(), a);
+        return pct_decode_unchecked(
+            encoded_userinfo(),
+            pt_.decoded[id_user] + (
+                has_password() ? 1 +
+                pt_.decoded[id_pass] : 0),
+            a);
+    }
+
+    /** Return the userinfo as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see userinfo
+    */
+    pct_decoded_view
+    decoded_userinfo() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_userinfo(),
+            pt_.decoded[id_user] + (
+                has_password() ? 1 +
+                pt_.decoded[id_pass] : 0));
     }
 
     /** Return the username if it exists, or an empty string
@@ -281,8 +316,28 @@ public:
     username(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_username(), a);
+        return pct_decode_unchecked(
+            encoded_username(),
+            pt_.decoded[id_user], a);
+    }
+
+    /** Return the username as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see username
+    */
+    pct_decoded_view
+    decoded_username() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_username(),
+            pt_.decoded[id_user]);
     }
 
     /** Return true if a password exists
@@ -306,8 +361,28 @@ public:
     password(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_password(), a);
+        return pct_decode_unchecked(
+            encoded_password(),
+            pt_.decoded[id_pass], a);
+    }
+
+    /** Return the password as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see password
+    */
+    pct_decoded_view
+    decoded_password() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_password(),
+            pt_.decoded[id_pass]);
     }
 
     //--------------------------------------------
@@ -376,6 +451,29 @@ public:
             s0, pt_.decoded[id_host], a);
     }
 
+    /** Return the host as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see host
+    */
+    pct_decoded_view
+    decoded_host() const noexcept
+    {
+        auto const s0 =
+            encoded_host();
+        if(pt_.host_type !=
+            urls::host_type::name)
+            return pct_decoded_view(s0);
+        return pct_decoded_view(
+            s0, pt_.decoded[id_host]);
+    }
+
     /** Return the ipv4 address if it exists, or return the unspecified address (0.0.0.0)
     */
     BOOST_URL_DECL
@@ -532,8 +630,28 @@ public:
     query(
         Allocator const& a = {}) const
     {
-        return detail::decode(
-            encoded_query(), a);
+        return pct_decode_unchecked(
+            encoded_query(),
+            pt_.decoded[id_query], a);
+    }
+
+    /** Return the query as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see query
+    */
+    pct_decoded_view
+    decoded_query() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_query(),
+            pt_.decoded[id_query]);
     }
 
     /** Return the query parameters as a read-only forward range
@@ -623,6 +741,25 @@ public:
             pt_.decoded[id_frag], a);
     }
 
+    /** Return the fragment as a view with percent-decoding applied
+
+        The returned view decodes characters as
+        they are visited, without allocating.
+
+        @par Exception Safety
+
+        No-throw guarantee.
+
+        @see fragment
+    */
+    pct_decoded_view
+    decoded_fragment() const noexcept
+    {
+        return pct_decoded_view(
+            encoded_fragment(),
+            pt_.decoded[id_frag]);
+    }
+
     //--------------------------------------------
     //
     // free functions
@@ -654,6 +791,32 @@ public:
     url_view
     parse_relative_ref(
         string_view s);
+
+    BOOST_URL_DECL
+    friend
+    url_view
+    parse_request_target(
+        string_view s,
+        target_form& form,
+        error_code& ec) noexcept;
+
+    BOOST_URL_DECL
+    friend
+    std::size_t
+    parse_uri_batch(
+        string_view const* s,
+        std::size_t n,
+        url_view* u,
+        error_code* ec) noexcept;
+
+    BOOST_URL_DECL
+    friend
+    std::size_t
+    parse_relative_ref_batch(
+        string_view const* s,
+        std::size_t n,
+        url_view* u,
+        error_code* ec) noexcept;
 };
 
 //------------------------------------------------
@@ -730,6 +893,80 @@ url_view
 parse_relative_ref(
     string_view s);
 
+/** Parse a sequence of URIs
+
+    This parses each of the `n` strings starting
+    at `s` as a URI, storing the view of the
+    i-th string in `u[i]`. If `ec` is not null,
+    the result of the i-th parse is stored in
+    `ec[i]`. Strings which fail to parse produce
+    a default constructed view.
+
+    This is equivalent to calling @ref parse_uri
+    on each string, but the per-call overhead is
+    paid once for the whole sequence.
+
+    @par Exception Safety
+
+    No-throw guarantee.
+
+    @return The number of strings which
+    failed to parse.
+
+    @param s A pointer to the first string.
+
+    @param n The number of strings.
+
+    @param u A pointer to storage for `n` views.
+
+    @param ec A pointer to storage for `n`
+    error codes, or `nullptr`.
+
+    @see parse_uri
+*/
+BOOST_URL_DECL
+std::size_t
+parse_uri_batch(
+    string_view const* s,
+    std::size_t n,
+    url_view* u,
+    error_code* ec = nullptr) noexcept;
+
+/** Parse a sequence of relative-refs
+
+    This parses each of the `n` strings starting
+    at `s` as a relative-ref, storing the view of
+    the i-th string in `u[i]`. If `ec` is not null,
+    the result of the i-th parse is stored in
+    `ec[i]`. Strings which fail to parse produce
+    a default constructed view.
+
+    @par Exception Safety
+
+    No-throw guarantee.
+
+    @return The number of strings which
+    failed to parse.
+
+    @param s A pointer to the first string.
+
+    @param n The number of strings.
+
+    @param u A pointer to storage for `n` views.
+
+    @param ec A pointer to storage for `n`
+    error codes, or `nullptr`.
+
+    @see parse_relative_ref
+*/
+BOOST_URL_DECL
+std::size_t
+parse_relative_ref_batch(
+    string_view const* s,
+    std::size_t n,
+    url_view* u,
+    error_code* ec = nullptr) noexcept;
+
 /** Format the serialized url to the output stream
 */
 BOOST_URL_DECL
@@ -0,0 +1,459 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/detail/dfa.hpp>
+
+#include <boost/url/detail/parse.hpp>
+#include <boost/url/bnf/parse.hpp>
+#include <boost/url/rfc/uri_bnf.hpp>
+#include <boost/url/rfc/relative_ref_bnf.hpp>
+
+#include "test_suite.hpp"
+
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+class dfa_test
+{
+public:
+    // parse using the grammar objects
+    static
+    bool
+    parse_bnf(
+        string_view s,
+        dfa::kind k,
+        parts& p)
+    {
+        error_code ec;
+        if(k == dfa::uri)
+        {
+            uri_bnf t;
+            if(! bnf::parse(s, ec, t))
+                return false;
+            p.resize(id_scheme,
+                t.scheme.str.size() + 1);
+            apply_authority(p, t.authority);
+            apply_path(p, t.path);
+            apply_query(p, t.query);
+            apply_fragment(p, t.fragment);
+            return true;
+        }
+        relative_ref_bnf t;
+        if(! bnf::parse(s, ec, t))
+            return false;
+        apply_authority(p, t.authority);
+        apply_path(p, t.path);
+        apply_query(p, t.query);
+        apply_fragment(p, t.fragment);
+        return true;
+    }
+
+    static
+    bool
+    same(
+        parts const& p0,
+        parts const& p1)
+    {
+        for(int i = 0; i <= id_end; ++i)
+            if(p0.offset[i] != p1.offset[i])
+                return false;
+        if( p0.nseg != p1.nseg ||
+            p0.nparam != p1.nparam ||
+            p0.host_type != p1.host_type ||
+            p0.port_number != p1.port_number)
+            return false;
+        if( p0.host_type == host_type::ipv4 &&
+            std::memcmp(p0.ip_addr,
+                p1.ip_addr, 4) != 0)
+            return false;
+        if( p0.host_type == host_type::ipv6 &&
+            std::memcmp(p0.ip_addr,
+                p1.ip_addr, 16) != 0)
+            return false;
+        if( p0.host_type == host_type::name &&
+            p0.decoded[id_host] !=
+                p1.decoded[id_host])
+            return false;
+        if( p0.length(id_frag) > 0 &&
+            p0.decoded[id_frag] !=
+                p1.decoded[id_frag])
+            return false;
+        return true;
+    }
+
+    // feed the input split at every position
+    static
+    void
+    check_split(
+        string_view s,
+        dfa::kind k,
+        parts const& p)
+    {
+        for(std::size_t i = 0;
+            i <= s.size(); ++i)
+        {
+            error_code ec;
+            dfa d(k);
+            if(! BOOST_TEST(
+                d.write(s.data(), i, ec) &&
+                d.write(s.data() + i,
+                    s.size() - i, ec) &&
+                d.finish(ec)))
+                continue;
+            BOOST_TEST(same(d.get(), p));
+        }
+    }
+
+    // both parsers agree
+    static
+    void
+    check(
+        string_view s,
+        dfa::kind k)
+    {
+        parts p0;
+        parts p1;
+        error_code ec;
+        bool const b0 = parse_bnf(s, k, p0);
+        bool const b1 = parse_dfa(s, k, p1, ec);
+        BOOST_TEST(match_dfa(s, k) == b1);
+        if(! BOOST_TEST(b0 == b1))
+            return;
+        if(! b0)
+            return;
+        BOOST_TEST(same(p0, p1));
+        check_split(s, k, p1);
+    }
+
+    static
+    void
+    good(
+        string_view s,
+        dfa::kind k = dfa::uri)
+    {
+        parts p;
+        error_code ec;
+        BOOST_TEST(parse_dfa(s, k, p, ec));
+        BOOST_TEST(! ec);
+        BOOST_TEST(match_dfa(s, k));
+    }
+
+    static
+    void
+    bad(
+        string_view s,
+        dfa::kind k = dfa::uri,
+        error_code e = error::syntax)
+    {
+        parts p;
+        error_code ec;
+        BOOST_TEST(! parse_dfa(s, k, p, ec));
+        BOOST_TEST(ec == e);
+        BOOST_TEST(! match_dfa(s, k));
+    }
+
+    void
+    testGrammar()
+    {
+        auto const u = dfa::uri;
+        auto const r = dfa::relative_ref;
+
+        check("", u);
+        check(":", u);
+        check("1:", u);
+        check("http://##", u);
+        check("http:", u);
+        check("http:x", u);
+        check("http:x/", u);
+        check("http:x/x", u);
+        check("http:x//", u);
+        check("http:x:y", u);
+        check("http:x@y", u);
+        check("http://", u);
+        check("http://x", u);
+        check("http://x.y.z", u);
+        check("http://x.y.z/", u);
+        check("http://x.y.z/?", u);
+        check("http://x.y.z/?a", u);
+        check("http://x.y.z/?a=", u);
+        check("http://x.y.z/?a=b", u);
+        check("http://x.y.z/?a=b&c=d", u);
+        check("http://x.y.z/?a=b&c=d&", u);
+        check("http://x.y.z/?a=b&c=d&#", u);
+        check("http://x.y.z/?a=b&c=d&#1", u);
+        check("http://x.y.z/?a=b&c=d&#12%23", u);
+        check("http://x.y.z/?a=b&c=d&#12%23%20", u);
+        check("http://x/a/b/c/", u);
+        check("http://x//a//", u);
+        check("http://x?a/b?c", u);
+        check("http://x#a/b?c", u);
+        check("http://x:", u);
+        check("http://x:80", u);
+        check("http://x:80/", u);
+        check("http://:80", u);
+        check("http://@", u);
+        check("http://@:", u);
+        check("http://u@x", u);
+        check("http://u:@x", u);
+        check("http://:p@x", u);
+        check("http://u:p@x:80/", u);
+        check("http://u:p:q@x", u);
+        check("http://u:1@x", u);
+        check("http://u%41:p%42@x%43", u);
+        check("http://u@x@y", u);
+        check("http://x:y", u);
+        check("http://x:1y", u);
+        check("http://%", u);
+        check("http://%4", u);
+        check("http://%4g", u);
+        check("http://x/%41%42", u);
+        check("http://x/%4", u);
+        check("http://[", u);
+        check("http://[]", u);
+        check("http://[::]", u);
+        check("http://[::1]", u);
+        check("http://[::1]:", u);
+        check("http://[::1]:80/", u);
+        check("http://u@[::1]:80/", u);
+        check("http://[::1]x", u);
+        check("http://[1:2:3:4:5:6:7:8]", u);
+        check("http://[1:2:3:4:5:6:7:8:9]", u);
+        check("http://[1:2:3:4:5:6:7]", u);
+        check("http://[1:2:3:4:5:6:7::]", u);
+        check("http://[1:2:3:4::5:6:7:8]", u);
+        check("http://[::1:2:3:4:5:6:7]", u);
+        check("http://[1::2:3]", u);
+        check("http://[1:::2]", u);
+        check("http://[1::2::3]", u);
+        check("http://[12345::]", u);
+        check("http://[ffff::]", u);
+        check("http://[::ffff:1.2.3.4]", u);
+        check("http://[1:2:3:4:5:6:1.2.3.4]", u);
+        check("http://[1:2:3:4:5:6:7:1.2.3.4]", u);
+        check("http://[::1.2.3]", u);
+        check("http://[::1.2.3.4.5]", u);
+        check("http://[::1.2.3.256]", u);
+        check("http://[::01.2.3.4]", u);
+        check("http://[v1.x]", u);
+        check("http://[v1.]", u);
+        check("http://[v.x]", u);
+        check("http://[vf:x]", u);
+        check("http://0.0.0.0", u);
+        check("http://1.2.3.4", u);
+        check("http://1.2.3.4:80", u);
+        check("http://1.2.3", u);
+        check("http://1.2.3.", u);
+        check("http://1.2.3.04", u);
+        check("http://1.2.3.256", u);
+        check("http://255.255.255.255/", u);
+        check("http://u@1.2.3.4", u);
+        check("http://1.2.3.4@x", u);
+        check("http:x?#", u);
+        check("http:x[", u);
+        check("http:x]", u);
+        check("http:x y", u);
+
+        check("", r);
+        check("x", r);
+        check("x/y", r);
+        check("x:y", r);
+        check("./x:y", r);
+        check("x@y:z", r);
+        check("/x", r);
+        check("/x/y/", r);
+        check("//", r);
+        check("//x", r);
+        check("//x/", r);
+        check("//x:80/y?z#f", r);
+        check("//u:p@x:80/y?z#f", r);
+        check("//[::1]/", r);
+        check("?", r);
+        check("?a&b", r);
+        check("#", r);
+        check("#f", r);
+        check("x?y#z", r);
+        check("%41", r);
+        check("%41:", r);
+        check("%4", r);
+        check("http://x", r);
+    }
+
+    void
+    testDivergence()
+    {
+        auto const u = dfa::uri;
+        auto const r = dfa::relative_ref;
+
+        // accepted here, rejected by the grammar
+        // objects, which deviate from RFC 3986
+        good("/", r);
+        good("/?", r);
+        good("/#", r);
+        good("http:/", u);
+        good("http:?q", u);
+        good("http:#f", u);
+        good("git+ssh://x", u);
+        good("a.b-c:", u);
+        good("http://[V1.x]", u);
+
+        // an IPv4address must be followed
+        // by the end of the host
+        {
+            parts p;
+            error_code ec;
+            BOOST_TEST(parse_dfa(
+                "http://1.2.3.4x/", u, p, ec));
+            BOOST_TEST(p.host_type ==
+                host_type::name);
+            BOOST_TEST(parse_dfa(
+                "http://1.2.3.4.5/", u, p, ec));
+            BOOST_TEST(p.host_type ==
+                host_type::name);
+        }
+
+        // port_number is zero when out of range
+        {
+            parts p;
+            error_code ec;
+            BOOST_TEST(parse_dfa(
+                "http://x:65535", u, p, ec));
+            BOOST_TEST(p.port_number == 65535);
+            BOOST_TEST(parse_dfa(
+                "http://x:65536", u, p, ec));
+            BOOST_TEST(p.port_number == 0);
+            BOOST_TEST(parse_dfa(
+                "http://x:99999999999", u, p, ec));
+            BOOST_TEST(p.port_number == 0);
+        }
+
+        // pct-encoding is checked everywhere
+        bad("http:?a=%", u,
+            error::incomplete_pct_encoding);
+        bad("?a=%4g", r,
+            error::bad_pct_encoding_digit);
+    }
+
+    void
+    testErrors()
+    {
+        auto const u = dfa::uri;
+        auto const r = dfa::relative_ref;
+
+        bad("", u);
+        bad("1:", u);
+        bad("http", u);
+        bad("x:y", r);
+        bad("http://x y", u);
+        bad("http://[::1", u);
+        bad("http://[::1]]", u);
+        bad("http://u:p:q", u);
+        bad("%", r,
+            error::incomplete_pct_encoding);
+        bad("%4", r,
+            error::incomplete_pct_encoding);
+        bad("%x1", r,
+            error::bad_pct_encoding_digit);
+        bad("%1x", r,
+            error::bad_pct_encoding_digit);
+        bad("#%41%", r,
+            error::incomplete_pct_encoding);
+
+        // once failed, stays failed
+        {
+            error_code ec;
+            dfa d(u);
+            BOOST_TEST(! d.write("1", 1, ec));
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(! d.write("x", 1, ec));
+            BOOST_TEST(! d.finish(ec));
+        }
+    }
+
+    void
+    testParts()
+    {
+        // decoded sizes
+        {
+            string_view s =
+                "http://%41u:%42p@h%43:80"
+                "/%44/x?q%45=1#f%46";
+            parts p;
+            error_code ec;
+            BOOST_TEST(parse_dfa(
+                s, dfa::uri, p, ec));
+            BOOST_TEST(p.decoded[id_scheme] == 4);
+            BOOST_TEST(p.decoded[id_user] == 2);
+            BOOST_TEST(p.decoded[id_pass] == 2);
+            BOOST_TEST(p.decoded[id_host] == 2);
+            BOOST_TEST(p.decoded[id_port] == 2);
+            BOOST_TEST(p.decoded[id_path] == 4);
+            BOOST_TEST(p.decoded[id_query] == 4);
+            BOOST_TEST(p.decoded[id_frag] == 2);
+            BOOST_TEST(p.nseg == 2);
+            BOOST_TEST(p.nparam == 1);
+            BOOST_TEST(p.port_number == 80);
+        }
+
+        // IPv6address bytes
+        {
+            parts p;
+            error_code ec;
+            BOOST_TEST(parse_dfa(
+                "//[1:203::ffff:1.2.3.4]",
+                dfa::relative_ref, p, ec));
+            unsigned char const b[16] = {
+                0, 1, 2, 3, 0, 0, 0, 0,
+                0, 0, 0xff, 0xff, 1, 2, 3, 4 };
+            BOOST_TEST(p.host_type ==
+                host_type::ipv6);
+            BOOST_TEST(std::memcmp(
+                p.ip_addr, b, 16) == 0);
+        }
+
+        // URI-reference
+        {
+            parts p;
+            error_code ec;
+            BOOST_TEST(parse_dfa("x:y",
+                dfa::uri_reference, p, ec));
+            BOOST_TEST(p.length(id_scheme) == 2);
+            BOOST_TEST(parse_dfa("x/y:z",
+                dfa::uri_reference, p, ec));
+            BOOST_TEST(p.length(id_scheme) == 0);
+            BOOST_TEST(p.nseg == 2);
+            BOOST_TEST(parse_dfa("//x",
+                dfa::uri_reference, p, ec));
+            BOOST_TEST(p.host_type ==
+                host_type::name);
+            BOOST_TEST(! parse_dfa("1:y",
+                dfa::uri_reference, p, ec));
+        }
+    }
+
+    void
+    run()
+    {
+        testGrammar();
+        testDivergence();
+        testErrors();
+        testParts();
+    }
+};
+
+TEST_SUITE(
+    dfa_test,
+    "boost.url.detail.dfa");
+
+} // detail
+} // urls
+} // boost
@@ -9,3 +9,196 @@
 
 // Test that header file is self-contained.
 #include <boost/url/bnf/range.hpp>
+
+#include <boost/url/bnf/parse.hpp>
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace urls {
+namespace bnf {
+
+class range_test
+{
+public:
+    // digits *( "," digits )
+    struct list_bnf
+    {
+        static
+        bool
+        begin(
+            char const*& it,
+            char const* const end,
+            error_code& ec,
+            string_view& t) noexcept
+        {
+            if(it == end)
+            {
+                ec = error::end;
+                return false;
+            }
+            return digits(it, end, ec, t);
+        }
+
+        static
+        bool
+        increment(
+            char const*& it,
+            char const* const end,
+            error_code& ec,
+            string_view& t) noexcept
+        {
+            if( it == end ||
+                *it != ',')
+            {
+                ec = error::end;
+                return false;
+            }
+            ++it;
+            return digits(it, end, ec, t);
+        }
+
+        static
+        bool
+        digits(
+            char const*& it,
+            char const* const end,
+            error_code& ec,
+            string_view& t) noexcept
+        {
+            auto const start = it;
+            while( it != end &&
+                *it >= '0' && *it <= '9')
+                ++it;
+            if(it == start)
+            {
+                ec = error::syntax;
+                return false;
+            }
+            t = string_view(
+                start, it - start);
+            return true;
+        }
+    };
+
+    using typed = range<
+        string_view, list_bnf>;
+
+    using erased = range<string_view>;
+
+    template<class Range>
+    static
+    std::vector<std::string>
+    elements(Range const& r)
+    {
+        std::vector<std::string> v;
+        for(auto const& t : r)
+            v.emplace_back(t);
+        return v;
+    }
+
+    void
+    testTyped()
+    {
+        std::vector<std::string> const v0;
+        std::vector<std::string> const v1 =
+            { "1", "22", "333" };
+        error_code ec;
+        typed r;
+
+        BOOST_TEST(parse("", ec, r));
+        BOOST_TEST(r.empty());
+        BOOST_TEST(r.size() == 0);
+        BOOST_TEST(r.begin() == r.end());
+        BOOST_TEST(elements(r) == v0);
+
+        BOOST_TEST(parse("1,22,333", ec, r));
+        BOOST_TEST(! r.empty());
+        BOOST_TEST(r.size() == 3);
+        BOOST_TEST(r.str() == "1,22,333");
+        BOOST_TEST(elements(r) == v1);
+
+        auto it = r.begin();
+        BOOST_TEST(*it == "1");
+        BOOST_TEST(*it++ == "1");
+        BOOST_TEST(it->size() == 2);
+        BOOST_TEST(++it != r.end());
+        BOOST_TEST(*it == "333");
+        BOOST_TEST(++it == r.end());
+
+        BOOST_TEST(! parse("x", ec, r));
+        BOOST_TEST(! parse("1,", ec, r));
+        BOOST_TEST(! parse("1,,2", ec, r));
+        BOOST_TEST(! parse("1;2", ec, r));
+
+        // stops at the end of the list
+        {
+            string_view s = "1,2;3";
+            auto it0 = s.data();
+            BOOST_TEST(parse_range(
+                it0, s.data() + s.size(),
+                    ec, r));
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(it0 == s.data() + 3);
+            BOOST_TEST(r.size() == 2);
+            BOOST_TEST(r.str() == "1,2");
+        }
+    }
+
+    void
+    testErased()
+    {
+        std::vector<std::string> const v1 =
+            { "1", "22", "333" };
+        error_code ec;
+        typed r;
+        BOOST_TEST(parse("1,22,333", ec, r));
+
+        // conversion
+        erased e = r;
+        BOOST_TEST(e.size() == 3);
+        BOOST_TEST(e.str() == r.str());
+        BOOST_TEST(elements(e) == v1);
+
+        // parse_range with a grammar object
+        {
+            string_view s = "4,5";
+            auto it = s.data();
+            BOOST_TEST(parse_range(
+                it, s.data() + s.size(),
+                    ec, e, list_bnf{}));
+            BOOST_TEST(it == s.data() + s.size());
+            BOOST_TEST(e.size() == 2);
+            BOOST_TEST(e.str() == "4,5");
+            BOOST_TEST(elements(e) ==
+                std::vector<std::string>(
+                    { "4", "5" }));
+        }
+        {
+            string_view s = "4,";
+            auto it = s.data();
+            BOOST_TEST(! parse_range(
+                it, s.data() + s.size(),
+                    ec, e, list_bnf{}));
+            BOOST_TEST(ec == error::syntax);
+            BOOST_TEST(e.empty());
+        }
+    }
+
+    void
+    run()
+    {
+        testTyped();
+        testErased();
+    }
+};
+
+TEST_SUITE(
+    range_test,
+    "boost.url.range");
+
+} // bnf
+} // urls
+} // boost
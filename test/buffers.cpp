@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/buffers.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class buffers_test
+{
+public:
+    // a buffer whose data() is void const*
+    struct const_buffer
+    {
+        void const* p;
+        std::size_t n;
+
+        void const*
+        data() const noexcept
+        {
+            return p;
+        }
+
+        std::size_t
+        size() const noexcept
+        {
+            return n;
+        }
+    };
+
+    // split s into separately
+    // allocated pieces at i and j
+    static
+    std::vector<std::string>
+    split(
+        string_view s,
+        std::size_t i,
+        std::size_t j)
+    {
+        return {
+            s.substr(0, i).to_string(),
+            s.substr(i, j - i).to_string(),
+            s.substr(j).to_string() };
+    }
+
+    void
+    testUri()
+    {
+        string_view const s =
+            "http://user:pass@[::1]:8080/a/%41?x=1&y#f";
+        auto const u0 = parse_uri(s);
+        for(std::size_t i = 0; i <= s.size(); ++i)
+        for(std::size_t j = i; j <= s.size(); ++j)
+        {
+            auto const v = split(s, i, j);
+            static_pool<256> sp;
+            error_code ec;
+            auto const u = parse_uri(v, sp, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(u.encoded_url() == s);
+            BOOST_TEST(u.encoded_host() == u0.encoded_host());
+            BOOST_TEST(u.port_number() == 8080);
+            BOOST_TEST(u.ipv6_address() == u0.ipv6_address());
+            BOOST_TEST(u.path().size() == 2);
+            BOOST_TEST(u.query_params().size() == 2);
+            BOOST_TEST(u.encoded_fragment() == "f");
+        }
+    }
+
+    void
+    testZeroCopy()
+    {
+        string_view const s =
+            "http://www.example.com/path?q";
+        static_pool<1> sp;
+        error_code ec;
+        {
+            // one buffer
+            std::vector<string_view> v{ s };
+            auto const u = parse_uri(v, sp, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(u.encoded_url().data() == s.data());
+        }
+        {
+            // adjacent buffers, with
+            // empty ones in between
+            std::vector<string_view> v{
+                s.substr(0, 0),
+                s.substr(0, 10),
+                s.substr(10, 0),
+                s.substr(10, 7),
+                s.substr(17) };
+            auto const u = parse_uri(v, sp, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(u.encoded_url().data() == s.data());
+            BOOST_TEST(u.encoded_host() == "www.example.com");
+        }
+        {
+            // not adjacent, pool too small
+            auto const v = split(s, 5, 10);
+            BOOST_TEST_THROWS(parse_uri(v, sp, ec),
+                std::bad_alloc);
+        }
+        {
+            // const_buffer-like elements
+            auto const v = split(s, 5, 10);
+            const_buffer const b[3] = {
+                { v[0].data(), v[0].size() },
+                { v[1].data(), v[1].size() },
+                { v[2].data(), v[2].size() } };
+            static_pool<64> sp2;
+            auto const u = parse_uri(b, sp2, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(u.encoded_url() == s);
+        }
+    }
+
+    void
+    testRelativeRef()
+    {
+        auto const v = split("//host/a?b", 3, 7);
+        static_pool<64> sp;
+        error_code ec;
+        auto const u = parse_relative_ref(v, sp, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_host() == "host");
+        BOOST_TEST(u.encoded_path() == "/a");
+        BOOST_TEST(u.encoded_query() == "b");
+
+        parse_relative_ref(split("x:y", 1, 2), sp, ec);
+        BOOST_TEST(ec);
+    }
+
+    void
+    testQueryParams()
+    {
+        string_view const s = "a=1&b=%20&c";
+        for(std::size_t i = 0; i <= s.size(); ++i)
+        {
+            auto const v = split(s, i, i);
+            static_pool<64> sp;
+            error_code ec;
+            auto const qp =
+                parse_query_params(v, sp, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(qp.size() ==
+                parse_query_params(s).size());
+            BOOST_TEST(qp.size() == 3);
+        }
+        {
+            static_pool<64> sp;
+            error_code ec;
+            std::vector<string_view> v{ "a=1", "#" };
+            parse_query_params(v, sp, ec);
+            BOOST_TEST(ec);
+            std::vector<string_view> v2{ "a=%", "g" };
+            parse_query_params(v2, sp, ec);
+            BOOST_TEST(ec);
+            std::vector<string_view> v3;
+            auto const qp =
+                parse_query_params(v3, sp, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(qp.size() ==
+                parse_query_params("").size());
+        }
+    }
+
+    void
+    run()
+    {
+        testUri();
+        testZeroCopy();
+        testRelativeRef();
+        testQueryParams();
+    }
+};
+
+TEST_SUITE(
+    buffers_test,
+    "boost.url.buffers");
+
+} // urls
+} // boost
@@ -65,6 +65,9 @@ public:
         check(condition::parse_error, error::bad_pct_encoding_digit);
         check(condition::parse_error, error::incomplete_pct_encoding);
         check(condition::parse_error, error::illegal_reserved_char);
+        check(condition::parse_error, error::number_overflow);
+
+        check(error::capacity_exceeded);
     }
 };
 
@@ -13,6 +13,7 @@
 #include <boost/url/bnf/char_set.hpp>
 #include <boost/url/bnf/parse.hpp>
 #include <boost/url/string.hpp>
+#include <cstring>
 #include <initializer_list>
 
 #include "test_suite.hpp"
@@ -73,6 +74,56 @@ test_char_set(
                 &c, &c+1, cs) == &c);
         }
     });
+
+    // test long runs, to exercise
+    // any vectorized implementation
+    if(s.empty() || n == 256)
+        return;
+    char const in = s[0];
+    char out = 0;
+    while(cs(out))
+        ++out;
+    char buf[72];
+    for(std::size_t len = 0;
+        len <= sizeof(buf); ++len)
+    {
+        std::memset(buf, in, len);
+        BOOST_TEST(bnf::find_if(
+            buf, buf + len, cs) == buf);
+        BOOST_TEST(bnf::find_if_not(
+            buf, buf + len, cs) == buf + len);
+        for(std::size_t i = 0; i < len; ++i)
+        {
+            buf[i] = out;
+            BOOST_TEST(bnf::find_if_not(
+                buf, buf + len, cs) == buf + i);
+            std::memset(buf, out, len);
+            buf[i] = in;
+            BOOST_TEST(bnf::find_if(
+                buf, buf + len, cs) == buf + i);
+            std::memset(buf, in, len);
+        }
+    }
+
+    // every character value in
+    // a few positions of a vector
+    for_each_char(
+    [&](char c)
+    {
+        for(std::size_t i = 0; i < 40; i += 13)
+        {
+            std::memset(buf, in, 40);
+            buf[i] = c;
+            BOOST_TEST(bnf::find_if_not(
+                buf, buf + 40, cs) ==
+                    (cs(c) ? buf + 40 : buf + i));
+            std::memset(buf, out, 40);
+            buf[i] = c;
+            BOOST_TEST(bnf::find_if(
+                buf, buf + 40, cs) ==
+                    (cs(c) ? buf + i : buf + 40));
+        }
+    });
 }
 
 template<
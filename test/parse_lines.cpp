@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/parse_lines.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class parse_lines_test
+{
+public:
+    static
+    std::size_t
+    count_urls(parsed_lines const& r)
+    {
+        std::size_t n = 0;
+        for(auto const& c : r.chunks)
+            n += c.urls.size();
+        return n;
+    }
+
+    static
+    std::size_t
+    count_errors(parsed_lines const& r)
+    {
+        std::size_t n = 0;
+        for(auto const& w : r.workers)
+            n += w.errors;
+        return n;
+    }
+
+    void
+    testChunks()
+    {
+        std::string s;
+        for(int i = 0; i < 1000; ++i)
+        {
+            s += "http://example.com/" +
+                std::to_string(i);
+            if(i % 7 == 0)
+                s += '\r';
+            s += '\n';
+            if(i % 100 == 0)
+            {
+                s += "%bad\n";
+                s += "\n";
+            }
+        }
+        // no trailing newline
+        s += "x:last";
+
+        for(std::size_t chunk : {
+            std::size_t(1), std::size_t(17),
+            std::size_t(4096), std::size_t(0) })
+        for(std::size_t threads : {
+            std::size_t(1), std::size_t(4),
+            std::size_t(0) })
+        {
+            auto const r = parse_uri_lines(
+                s, threads, chunk);
+            BOOST_TEST(count_urls(r) == 1001);
+            BOOST_TEST(count_errors(r) == 10);
+            BOOST_TEST(! r.workers.empty());
+
+            // chunks cover the buffer
+            // in order, on line ends
+            std::size_t lines = 0;
+            char const* p = s.data();
+            int i = 0;
+            for(auto const& c : r.chunks)
+            {
+                BOOST_TEST(c.text.data() == p);
+                p += c.text.size();
+                if(p != s.data() + s.size())
+                    BOOST_TEST(p[-1] == '\n');
+                for(auto const& u : c.urls)
+                {
+                    if(i < 1000)
+                        BOOST_TEST(u.encoded_path() ==
+                            "/" + std::to_string(i));
+                    else
+                        BOOST_TEST(u.encoded_url() ==
+                            "x:last");
+                    BOOST_TEST(u.encoded_url().data() >=
+                        c.text.data());
+                    ++i;
+                }
+                for(auto const& f : c.failures)
+                    BOOST_TEST(f == "%bad");
+            }
+            BOOST_TEST(p == s.data() + s.size());
+            for(auto const& w : r.workers)
+                lines += w.lines;
+            BOOST_TEST(lines == 1011);
+        }
+    }
+
+    void
+    testRelative()
+    {
+        string_view s =
+            "/a\n"
+            "b/c?d\n"
+            "http://x\n"
+            "//host/path\n";
+        auto const r =
+            parse_relative_ref_lines(s, 2);
+        BOOST_TEST(count_urls(r) == 3);
+        BOOST_TEST(count_errors(r) == 1);
+        BOOST_TEST(r.chunks.size() == 1);
+        BOOST_TEST(r.chunks[0].failures.size() == 1);
+        BOOST_TEST(r.chunks[0].failures[0] == "http://x");
+        BOOST_TEST(r.chunks[0].urls[2].encoded_host() ==
+            "host");
+    }
+
+    void
+    testEmpty()
+    {
+        auto const r = parse_uri_lines("");
+        BOOST_TEST(r.chunks.empty());
+        BOOST_TEST(r.workers.size() == 1);
+        BOOST_TEST(r.workers[0].lines == 0);
+    }
+
+    void
+    run()
+    {
+        testChunks();
+        testRelative();
+        testEmpty();
+    }
+};
+
+TEST_SUITE(
+    parse_lines_test,
+    "boost.url.parse_lines");
+
+} // urls
+} // boost
@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/path_index.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class path_index_test
+{
+public:
+    void
+    check(
+        path_view p,
+        std::vector<std::string> const& m)
+    {
+        std::vector<std::size_t> buf(
+            path_index::buffer_size(p));
+        path_index const idx(
+            p, buf.data(), buf.size());
+        BOOST_TEST(idx.size() == m.size());
+        BOOST_TEST(idx.empty() == m.empty());
+        auto it = p.begin();
+        for(std::size_t i = 0;
+            i < m.size(); ++i, ++it)
+        {
+            BOOST_TEST(idx[i].segment() == m[i]);
+            BOOST_TEST(idx.encoded_segment(i) ==
+                it->encoded_segment());
+        }
+        if(m.empty())
+            return;
+        BOOST_TEST(idx.front().segment() == m.front());
+        BOOST_TEST(idx.back().segment() == m.back());
+    }
+
+    void
+    testIndex()
+    {
+        {
+            path_index idx;
+            BOOST_TEST(idx.empty());
+            BOOST_TEST(idx.size() == 0);
+        }
+
+        check(parse_path(""), {});
+        check(parse_path("/"), { "" });
+        check(parse_path("//"), { "", "" });
+        check(parse_path("/a/b/"), { "a", "b", "" });
+        check(parse_path("/api/v1/users/%41%42"),
+            { "api", "v1", "users", "AB" });
+        check(parse_relative_ref("a").path(), { "a" });
+        check(parse_relative_ref("a/b%20c/d").path(),
+            { "a", "b c", "d" });
+
+        // buffer too small
+        std::size_t buf[2];
+        BOOST_TEST_THROWS(path_index(
+            parse_path("/a/b"), buf, 2),
+            std::length_error);
+        path_index idx(
+            parse_path("/a"), buf, 2);
+        BOOST_TEST(idx.back().segment() == "a");
+    }
+
+    void
+    run()
+    {
+        testIndex();
+    }
+};
+
+TEST_SUITE(
+    path_index_test,
+    "boost.url.path_index");
+
+} // urls
+} // boost
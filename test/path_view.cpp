@@ -10,9 +10,12 @@
 // Test that header file is self-contained.
 #include <boost/url/path_view.hpp>
 
+#include <boost/url/url_view.hpp>
 #include "test_suite.hpp"
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace boost {
 namespace urls {
@@ -39,11 +42,67 @@ public:
         BOOST_TEST(it == p.begin());
     }
 
+    static
+    std::vector<std::string>
+    forward(path_view p)
+    {
+        std::vector<std::string> v;
+        for(auto const& e : p)
+            v.push_back(e.segment());
+        return v;
+    }
+
+    static
+    std::vector<std::string>
+    backward(path_view p)
+    {
+        std::vector<std::string> v;
+        auto it = p.end();
+        while(it != p.begin())
+            v.insert(v.begin(),
+                (--it)->segment());
+        return v;
+    }
+
+    void
+    check(
+        path_view p,
+        std::vector<std::string> const& m)
+    {
+        BOOST_TEST(p.size() == m.size());
+        BOOST_TEST(forward(p) == m);
+        BOOST_TEST(backward(p) == m);
+        if(m.empty())
+            return;
+        BOOST_TEST(p.front().segment() == m.front());
+        BOOST_TEST(p.back().segment() == m.back());
+    }
+
     void
     testContents()
     {
-        auto p = parse_path(
-            "/");
+        check(parse_path(""), {});
+        check(parse_path("/"), { "" });
+        check(parse_path("/a"), { "a" });
+        check(parse_path("/a/"), { "a", "" });
+        check(parse_path("//"), { "", "" });
+        check(parse_path("/a/b/c"), { "a", "b", "c" });
+        check(parse_path("/%41/b%20c/%2F"), { "A", "b c", "/" });
+
+        // relative paths
+        check(parse_relative_ref("a").path(), { "a" });
+        check(parse_relative_ref("a/b").path(), { "a", "b" });
+        check(parse_relative_ref("2..=").path(), { "2..=" });
+        check(parse_relative_ref("a/").path(), { "a", "" });
+        check(parse_uri("x:a/%62/").path(), { "a", "b", "" });
+
+        auto const p = parse_path("/a%20b/c");
+        auto it = p.begin();
+        BOOST_TEST(it->encoded_segment() == "a%20b");
+        BOOST_TEST(it->decoded_segment().size() == 3);
+        BOOST_TEST((it++)->segment() == "a b");
+        BOOST_TEST((it--)->segment() == "c");
+        BOOST_TEST(it == p.begin());
     }
 
     void
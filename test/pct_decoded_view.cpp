@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/pct_decoded_view.hpp>
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+namespace boost {
+namespace urls {
+
+class pct_decoded_view_test
+{
+public:
+    void
+    testMembers()
+    {
+        {
+            pct_decoded_view v;
+            BOOST_TEST(v.empty());
+            BOOST_TEST(v.size() == 0);
+            BOOST_TEST(v.encoded() == "");
+            BOOST_TEST(v.begin() == v.end());
+            BOOST_TEST(v.to_string() == "");
+        }
+        {
+            pct_decoded_view v("a%20b%2fc");
+            BOOST_TEST(! v.empty());
+            BOOST_TEST(v.size() == 5);
+            BOOST_TEST(v.encoded() == "a%20b%2fc");
+            BOOST_TEST(v.to_string() == "a b/c");
+
+            pct_decoded_view v2(
+                "a%20b%2fc", 5);
+            BOOST_TEST(v2.size() == 5);
+            BOOST_TEST(v2 == v);
+        }
+    }
+
+    void
+    testIterator()
+    {
+        pct_decoded_view v("%41b%43%44e");
+        std::string s;
+        for(char c : v)
+            s.push_back(c);
+        BOOST_TEST(s == "AbCDe");
+
+        // backwards
+        s.clear();
+        auto it = v.end();
+        while(it != v.begin())
+            s.push_back(*--it);
+        BOOST_TEST(s == "eDCbA");
+
+        it = v.begin();
+        BOOST_TEST(*it++ == 'A');
+        BOOST_TEST(*it == 'b');
+        BOOST_TEST(*it-- == 'b');
+        BOOST_TEST(it == v.begin());
+        BOOST_TEST(it.encoded() ==
+            v.encoded().data());
+
+        // "%25" decodes to a percent
+        // sign which is not an escape
+        s.clear();
+        pct_decoded_view v2("%2541");
+        for(char c : v2)
+            s.push_back(c);
+        BOOST_TEST(s == "%41");
+        it = v2.end();
+        BOOST_TEST(*--it == '1');
+        BOOST_TEST(*--it == '4');
+        BOOST_TEST(*--it == '%');
+        BOOST_TEST(it == v2.begin());
+    }
+
+    void
+    testCopy()
+    {
+        pct_decoded_view v(
+            "%E2%82%AC/%20space/%2Fslash-"
+            "and-a-longer-tail-for-the-kernel");
+        auto const s = v.to_string();
+        BOOST_TEST(s.size() == v.size());
+        BOOST_TEST(s ==
+            "\xE2\x82\xAC/ space//slash-"
+            "and-a-longer-tail-for-the-kernel");
+
+        // whole string, exact buffer
+        std::string buf(v.size(), '*');
+        BOOST_TEST(v.copy(
+            &buf[0], buf.size()) == v.size());
+        BOOST_TEST(buf == s);
+
+        // larger buffer
+        buf.assign(v.size() + 10, '*');
+        BOOST_TEST(v.copy(
+            &buf[0], buf.size()) == v.size());
+        BOOST_TEST(buf.substr(0, v.size()) == s);
+        BOOST_TEST(buf.substr(v.size()) ==
+            std::string(10, '*'));
+
+        // every prefix
+        for(std::size_t n = 0;
+            n < v.size(); ++n)
+        {
+            buf.assign(v.size(), '*');
+            BOOST_TEST(v.copy(
+                &buf[0], n) == n);
+            BOOST_TEST(buf.substr(0, n) ==
+                s.substr(0, n));
+            BOOST_TEST(buf[n] == '*');
+        }
+    }
+
+    void
+    testDecodeInto()
+    {
+        pct_decoded_view const v("a%20b%2fc");
+        char buf[8];
+
+        // too small, nothing written
+        std::fill(buf, buf + 8, '*');
+        BOOST_TEST(v.decode_into(
+            buf, buf + 4) == 5);
+        BOOST_TEST(string_view(
+            buf, 8) == "********");
+
+        // exact size
+        BOOST_TEST(v.decode_into(
+            buf, buf + 5) == 5);
+        BOOST_TEST(string_view(
+            buf, 8) == "a b/c***");
+
+        // larger
+        std::fill(buf, buf + 8, '*');
+        BOOST_TEST(v.decode_into(
+            buf, buf + 8) == 5);
+        BOOST_TEST(string_view(
+            buf, 8) == "a b/c***");
+
+        // empty
+        BOOST_TEST(pct_decoded_view(
+            "").decode_into(buf, buf) == 0);
+    }
+
+    // decode every component of u into
+    // one buffer, checking against the
+    // allocating accessors
+    template<class Url>
+    static
+    void
+    checkDecodeInto(Url const& u)
+    {
+        char buf[64];
+        char* p = buf;
+        char* const end = buf + sizeof(buf);
+        auto const put =
+            [&p, end](
+                pct_decoded_view v,
+                std::string const& s)
+            {
+                auto const n =
+                    v.decode_into(p, end);
+                BOOST_TEST(n == s.size());
+                BOOST_TEST(n <= std::size_t(
+                    end - p));
+                BOOST_TEST(string_view(
+                    p, n) == s);
+                p += n;
+            };
+        put(u.decoded_userinfo(), u.userinfo());
+        put(u.decoded_username(), u.username());
+        put(u.decoded_password(), u.password());
+        put(u.decoded_host(), u.host());
+        put(u.decoded_query(), u.query());
+        put(u.decoded_fragment(), u.fragment());
+    }
+
+    void
+    testCompare()
+    {
+        pct_decoded_view const v("a%62c");
+        BOOST_TEST(v == "abc");
+        BOOST_TEST("abc" == v);
+        BOOST_TEST(v == std::string("abc"));
+        BOOST_TEST(v != "ab");
+        BOOST_TEST(v != "abcd");
+        BOOST_TEST(v != "abd");
+        BOOST_TEST("abd" != v);
+        BOOST_TEST(v.compare("abc") == 0);
+        BOOST_TEST(v.compare("ab") > 0);
+        BOOST_TEST(v.compare("abcd") < 0);
+        BOOST_TEST(v.compare("abd") < 0);
+        BOOST_TEST(v.compare("abb") > 0);
+        BOOST_TEST(v < "abd");
+        BOOST_TEST(v <= "abc");
+        BOOST_TEST(v > "ab");
+        BOOST_TEST(v >= "abc");
+        BOOST_TEST("ab" < v);
+        BOOST_TEST("abd" > v);
+        BOOST_TEST("abc" <= v);
+        BOOST_TEST("abc" >= v);
+
+        // characters compare as unsigned
+        BOOST_TEST(pct_decoded_view("%FF") > "a");
+        BOOST_TEST(pct_decoded_view("%FF") >
+            pct_decoded_view("%7f"));
+
+        // different encodings of
+        // the same decoded string
+        pct_decoded_view const v2("%61b%63");
+        BOOST_TEST(v == v2);
+        BOOST_TEST(! (v != v2));
+        BOOST_TEST(v.compare(v2) == 0);
+        BOOST_TEST(v <= v2);
+        BOOST_TEST(v >= v2);
+        BOOST_TEST(! (v < v2));
+        BOOST_TEST(! (v > v2));
+        BOOST_TEST(pct_decoded_view("ab") < v);
+        BOOST_TEST(v > pct_decoded_view("ab"));
+        BOOST_TEST(pct_decoded_view("ab").compare(v) < 0);
+        BOOST_TEST(v.compare(pct_decoded_view("ab")) > 0);
+    }
+
+    void
+    testHash()
+    {
+        pct_decoded_view const v0("a%62c");
+        pct_decoded_view const v1("%61%62%63");
+        pct_decoded_view const v2("abd");
+        BOOST_TEST(hash_value(v0) == hash_value(v1));
+        BOOST_TEST(hash_value(v0) != hash_value(v2));
+        std::hash<pct_decoded_view> h;
+        BOOST_TEST(h(v0) == h(v1));
+
+        std::unordered_set<pct_decoded_view> set;
+        set.insert(v0);
+        BOOST_TEST(set.count(v1) == 1);
+        BOOST_TEST(set.count(v2) == 0);
+    }
+
+    void
+    testNumber()
+    {
+        error_code ec;
+        BOOST_TEST(pct_decoded_view("0"
+            ).to_number<unsigned>(ec) == 0);
+        BOOST_TEST(! ec);
+        BOOST_TEST(pct_decoded_view("%31%32"
+            "3").to_number<unsigned>(ec) == 123);
+        BOOST_TEST(! ec);
+        BOOST_TEST(pct_decoded_view("65535"
+            ).to_number<std::uint16_t>(ec) == 65535);
+        BOOST_TEST(! ec);
+        BOOST_TEST(pct_decoded_view(
+            "18446744073709551615").to_number<
+                std::uint64_t>(ec) ==
+                    18446744073709551615ULL);
+        BOOST_TEST(! ec);
+
+        pct_decoded_view("65536"
+            ).to_number<std::uint16_t>(ec);
+        BOOST_TEST(ec == error::number_overflow);
+        pct_decoded_view("18446744073709551616"
+            ).to_number<std::uint64_t>(ec);
+        BOOST_TEST(ec == error::number_overflow);
+        pct_decoded_view("").to_number<
+            unsigned>(ec);
+        BOOST_TEST(ec == error::syntax);
+        pct_decoded_view("1%20").to_number<
+            unsigned>(ec);
+        BOOST_TEST(ec == error::syntax);
+        pct_decoded_view("-1").to_number<
+            unsigned>(ec);
+        BOOST_TEST(ec == error::syntax);
+
+        BOOST_TEST(pct_decoded_view("42"
+            ).to_number<unsigned>() == 42);
+        BOOST_TEST_THROWS(pct_decoded_view("x"
+            ).to_number<unsigned>(), system_error);
+    }
+
+    void
+    testAccessors()
+    {
+        {
+            url_view const u = parse_uri(
+                "http://us%65r:p%61ss@h%6Fst/"
+                "a%20b/c?k%3D=v%26#fr%61g");
+            BOOST_TEST(u.decoded_userinfo() ==
+                u.userinfo());
+            BOOST_TEST(u.decoded_username() == "user");
+            BOOST_TEST(u.decoded_password() == "pass");
+            BOOST_TEST(u.decoded_host() == "host");
+            BOOST_TEST(u.decoded_query() == u.query());
+            BOOST_TEST(u.decoded_fragment() == "frag");
+
+            auto it = u.path().begin();
+            BOOST_TEST(it->decoded_segment() == "a b");
+            ++it;
+            BOOST_TEST(it->decoded_segment() == "c");
+
+            auto qp = u.query_params().begin();
+            BOOST_TEST(qp->decoded_key() == "k=");
+            BOOST_TEST(qp->decoded_value() == "v&");
+
+            checkDecodeInto(u);
+            char buf[4];
+            BOOST_TEST(qp->decoded_key().decode_into(
+                buf, buf + sizeof(buf)) == 2);
+            BOOST_TEST(string_view(buf, 2) == "k=");
+        }
+        {
+            url_view const u = parse_uri(
+                "http://[::1]:80/");
+            BOOST_TEST(u.decoded_host() == "[::1]");
+        }
+        {
+            url u(
+                "http://us%65r:p%61ss@h%6Fst/"
+                "a%20b?k%3D=v%26#fr%61g");
+            BOOST_TEST(u.decoded_userinfo() ==
+                u.userinfo());
+            BOOST_TEST(u.decoded_username() == "user");
+            BOOST_TEST(u.decoded_password() == "pass");
+            BOOST_TEST(u.decoded_host() == "host");
+            BOOST_TEST(u.decoded_query() == u.query());
+            BOOST_TEST(u.decoded_fragment() == "frag");
+            BOOST_TEST(u.path().begin()->
+                decoded_string() == "a b");
+            auto qp = u.query_params().begin();
+            BOOST_TEST(qp->decoded_key() == "k=");
+            BOOST_TEST(qp->decoded_value() == "v&");
+
+            // sizes recorded by the setters
+            checkDecodeInto(u);
+
+            u.set_user("a b");
+            u.set_fragment("x y");
+            BOOST_TEST(u.decoded_username() == "a b");
+            BOOST_TEST(u.decoded_fragment() == "x y");
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testIterator();
+        testCopy();
+        testDecodeInto();
+        testCompare();
+        testHash();
+        testNumber();
+        testAccessors();
+    }
+};
+
+TEST_SUITE(
+    pct_decoded_view_test,
+    "boost.url.pct_decoded_view");
+
+} // urls
+} // boost
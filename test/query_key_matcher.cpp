@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/query_key_matcher.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class query_key_matcher_test
+{
+public:
+    void
+    testFind()
+    {
+        query_key_matcher const m{
+            "page", "q", "sort", "", "limit", "a b", "q" };
+        BOOST_TEST(m.size() == 7);
+        BOOST_TEST(m[0] == "page");
+        BOOST_TEST(m[5] == "a b");
+
+        auto const find =
+            [&m](string_view s)
+            {
+                return m.find(
+                    pct_decoded_view(s));
+            };
+        BOOST_TEST(find("page") == 0);
+        BOOST_TEST(find("q") == 1);
+        BOOST_TEST(find("sort") == 2);
+        BOOST_TEST(find("") == 3);
+        BOOST_TEST(find("limit") == 4);
+        BOOST_TEST(find("a%20b") == 5);
+        BOOST_TEST(find("%70age") == 0);
+        BOOST_TEST(find("%71") == 1);
+        BOOST_TEST(find("pag") == query_key_matcher::npos);
+        BOOST_TEST(find("pages") == query_key_matcher::npos);
+        BOOST_TEST(find("a b c d e f") == query_key_matcher::npos);
+        BOOST_TEST(find("%50age") == query_key_matcher::npos);
+        BOOST_TEST(find("a+b") == query_key_matcher::npos);
+
+        string_view const v[] = { "x", "y" };
+        query_key_matcher const m2(v, 2);
+        BOOST_TEST(m2.find(pct_decoded_view("y")) == 1);
+        BOOST_TEST(m2.find(pct_decoded_view("")) ==
+            query_key_matcher::npos);
+
+        query_key_matcher const m3{};
+        BOOST_TEST(m3.size() == 0);
+        BOOST_TEST(m3.find(pct_decoded_view("")) ==
+            query_key_matcher::npos);
+    }
+
+    void
+    testExtract()
+    {
+        static query_key_matcher const m{
+            "a", "b", "c", "d" };
+        auto const qp = parse_query_params(
+            "x=0&a=1&%62=2&a=3&d&e=5");
+        query_params_view::iterator v[4];
+        BOOST_TEST(extract_query_params(
+            qp, m, v) == 3);
+        BOOST_TEST(v[0] != qp.end());
+        BOOST_TEST(v[0]->value() == "1");
+        BOOST_TEST(v[1]->encoded_key() == "%62");
+        BOOST_TEST(v[1]->value() == "2");
+        BOOST_TEST(v[2] == qp.end());
+        BOOST_TEST(! v[3]->has_value());
+
+        // the iterators can resume a search
+        BOOST_TEST(qp.find(v[0], "a")->value() == "3");
+
+        // nothing found
+        BOOST_TEST(extract_query_params(
+            parse_query_params("z=1"), m, v) == 0);
+        BOOST_TEST(extract_query_params(
+            query_params_view(), m, v) == 0);
+        BOOST_TEST(v[0] == query_params_view().end());
+    }
+
+    void
+    testForEach()
+    {
+        query_key_matcher const m{ "a", "b" };
+        auto const qp = parse_query_params(
+            "a=1&b=2&c=3&%61=4&b");
+        std::vector<std::pair<
+            std::size_t, std::string>> r;
+        for_each_query_param(qp, m,
+            [&r](std::size_t i,
+                query_params_view::value_type const& v)
+            {
+                r.emplace_back(i, v.value());
+            });
+        BOOST_TEST(r.size() == 4);
+        BOOST_TEST(r[0].first == 0 && r[0].second == "1");
+        BOOST_TEST(r[1].first == 1 && r[1].second == "2");
+        BOOST_TEST(r[2].first == 0 && r[2].second == "4");
+        BOOST_TEST(r[3].first == 1 && r[3].second == "");
+    }
+
+    void
+    run()
+    {
+        testFind();
+        testExtract();
+        testForEach();
+    }
+};
+
+TEST_SUITE(
+    query_key_matcher_test,
+    "boost.url.query_key_matcher");
+
+} // urls
+} // boost
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/query_params_index.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class query_params_index_test
+{
+public:
+    void
+    testEmpty()
+    {
+        query_params_index idx;
+        BOOST_TEST(idx.empty());
+        BOOST_TEST(idx.size() == 0);
+        BOOST_TEST(idx.begin() == idx.end());
+        BOOST_TEST(! idx.contains("a"));
+        BOOST_TEST(idx.count("a") == 0);
+        BOOST_TEST(idx.find("a") == idx.end());
+        BOOST_TEST(idx["a"] == "");
+        BOOST_TEST_THROWS(idx.at("a"),
+            std::out_of_range);
+
+        idx.assign(parse_query_params(""));
+        BOOST_TEST(idx.empty());
+        BOOST_TEST(! idx.contains(""));
+    }
+
+    void
+    testLookup()
+    {
+        query_params_index const idx(
+            parse_query_params(
+                "a=1&b=2&%61=3&c&d=%34&=e&a=5"));
+        BOOST_TEST(idx.size() == 7);
+
+        // in order
+        auto it = idx.begin();
+        BOOST_TEST(it->encoded_key() == "a");
+        ++it;
+        BOOST_TEST(it->encoded_key() == "b");
+        BOOST_TEST((it + 5)->encoded_value() == "5");
+
+        BOOST_TEST(idx.contains("a"));
+        BOOST_TEST(idx.contains("b"));
+        BOOST_TEST(idx.contains("c"));
+        BOOST_TEST(idx.contains("d"));
+        BOOST_TEST(idx.contains(""));
+        BOOST_TEST(! idx.contains("e"));
+        BOOST_TEST(! idx.contains("%61"));
+        BOOST_TEST(! idx.contains("aa"));
+
+        // encoded keys match their
+        // decoded form
+        BOOST_TEST(idx.count("a") == 3);
+        BOOST_TEST(idx.count("b") == 1);
+        BOOST_TEST(idx.count("e") == 0);
+
+        it = idx.find("a");
+        BOOST_TEST(it == idx.begin());
+        it = idx.find(it, "a");
+        BOOST_TEST(it == idx.begin() + 2);
+        BOOST_TEST(it->value() == "3");
+        it = idx.find(it, "a");
+        BOOST_TEST(it == idx.begin() + 6);
+        it = idx.find(it, "a");
+        BOOST_TEST(it == idx.end());
+        BOOST_TEST(idx.find(it, "a") == idx.end());
+
+        BOOST_TEST(idx["a"] == "1");
+        BOOST_TEST(idx["d"] == "4");
+        BOOST_TEST(idx["c"] == "");
+        BOOST_TEST(! idx.find("c")->has_value());
+        BOOST_TEST(idx[""] == "e");
+        BOOST_TEST(idx.at("b") == "2");
+        BOOST_TEST_THROWS(idx.at("x"),
+            std::out_of_range);
+    }
+
+    void
+    testMany()
+    {
+        // enough keys to fill several
+        // probe sequences
+        std::string s;
+        for(int i = 0; i < 500; ++i)
+        {
+            if(! s.empty())
+                s.push_back('&');
+            s += "k" + std::to_string(i) +
+                "=" + std::to_string(i * 2);
+        }
+        query_params_index idx;
+        idx.assign(parse_query_params(s));
+        BOOST_TEST(idx.size() == 500);
+        for(int i = 0; i < 500; ++i)
+        {
+            auto const k =
+                "k" + std::to_string(i);
+            BOOST_TEST(idx.count(k) == 1);
+            BOOST_TEST(idx[k] ==
+                std::to_string(i * 2));
+        }
+        BOOST_TEST(! idx.contains("k500"));
+
+        // reuse
+        idx.assign(parse_query_params("x=1"));
+        BOOST_TEST(idx.size() == 1);
+        BOOST_TEST(! idx.contains("k1"));
+        BOOST_TEST(idx["x"] == "1");
+        idx.clear();
+        BOOST_TEST(idx.empty());
+        BOOST_TEST(! idx.contains("x"));
+    }
+
+    void
+    testDuplicates()
+    {
+        // each match resumes the probe
+        // sequence, so these are linear
+        std::string s;
+        for(int i = 0; i < 20000; ++i)
+        {
+            if(! s.empty())
+                s.push_back('&');
+            s += (i % 4 == 3) ? "b=" : "a=";
+            s += std::to_string(i);
+        }
+        query_params_index idx;
+        idx.assign(parse_query_params(s));
+        BOOST_TEST(idx.count("a") == 15000);
+        BOOST_TEST(idx.count("b") == 5000);
+        BOOST_TEST(idx.count("c") == 0);
+
+        // every occurrence, in order
+        std::size_t n = 0;
+        int prev = -1;
+        for(auto it = idx.find("b");
+            it != idx.end();
+            it = idx.find(it, "b"))
+        {
+            auto const v = std::stoi(it->value());
+            BOOST_TEST(v % 4 == 3);
+            BOOST_TEST(v > prev);
+            prev = v;
+            ++n;
+        }
+        BOOST_TEST(n == 5000);
+
+        // after an element with another key
+        auto const it = idx.find(
+            idx.begin() + 4, "b");
+        BOOST_TEST(it->value() == "7");
+        BOOST_TEST(idx.find(
+            idx.end() - 1, "a") == idx.end());
+    }
+
+    void
+    run()
+    {
+        testEmpty();
+        testLookup();
+        testMany();
+        testDuplicates();
+    }
+};
+
+TEST_SUITE(
+    query_params_index_test,
+    "boost.url.query_params_index");
+
+} // urls
+} // boost
@@ -55,11 +55,64 @@ public:
         BOOST_TEST(match == m);
     }
 
+    void
+    testElements()
+    {
+        auto const qp = parse_query_params(
+            "a=1&b&c=&=d&&e=f=g&%41%42=%20x");
+        BOOST_TEST(qp.size() == 7);
+        auto it = qp.begin();
+        BOOST_TEST(it->encoded_key() == "a");
+        BOOST_TEST(it->has_value());
+        BOOST_TEST(it->encoded_value() == "1");
+        ++it;
+        BOOST_TEST(it->encoded_key() == "b");
+        BOOST_TEST(! it->has_value());
+        BOOST_TEST(it->encoded_value() == "");
+        ++it;
+        BOOST_TEST(it->encoded_key() == "c");
+        BOOST_TEST(it->has_value());
+        BOOST_TEST(it->encoded_value() == "");
+        ++it;
+        BOOST_TEST(it->encoded_key() == "");
+        BOOST_TEST(it->encoded_value() == "d");
+        ++it;
+        BOOST_TEST(it->encoded_key() == "");
+        BOOST_TEST(! it->has_value());
+        ++it;
+        BOOST_TEST(it->encoded_key() == "e");
+        BOOST_TEST(it->encoded_value() == "f=g");
+        ++it;
+        BOOST_TEST(it->key() == "AB");
+        BOOST_TEST(it->value() == " x");
+        BOOST_TEST(it->decoded_key().size() == 2);
+        BOOST_TEST(it->decoded_value().size() == 2);
+        ++it;
+        BOOST_TEST(it == qp.end());
+
+        // a trailing '&' is an empty key
+        auto const qp2 =
+            parse_query_params("a&");
+        it = qp2.begin();
+        BOOST_TEST((++it)->encoded_key() == "");
+        BOOST_TEST(++it == qp2.end());
+
+        // the string is validated up front
+        error_code ec;
+        parse_query_params("x=%", ec);
+        BOOST_TEST(ec.failed());
+        parse_query_params("x=%2", ec);
+        BOOST_TEST(ec.failed());
+        parse_query_params("%g=1", ec);
+        BOOST_TEST(ec.failed());
+    }
+
     void
     run()
     {
         testIterator();
         testContents();
+        testElements();
     }
 };
 
@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/request_target.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace urls {
+
+class request_target_test
+{
+public:
+    static
+    url_view
+    good(
+        string_view s,
+        target_form f)
+    {
+        target_form f1 = target_form::asterisk;
+        error_code ec;
+        auto const u =
+            parse_request_target(s, f1, ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(f1 == f);
+        BOOST_TEST(u.encoded_url() == s);
+        return u;
+    }
+
+    static
+    void
+    bad(string_view s)
+    {
+        target_form f;
+        error_code ec;
+        auto const u =
+            parse_request_target(s, f, ec);
+        BOOST_TEST(ec);
+        BOOST_TEST(u.empty());
+        BOOST_TEST_THROWS(
+            parse_request_target(s, f),
+            system_error);
+    }
+
+    void
+    testOrigin()
+    {
+        {
+            auto const u = good("/",
+                target_form::origin);
+            BOOST_TEST(u.encoded_path() == "/");
+            BOOST_TEST(! u.has_query());
+        }
+        {
+            auto const u = good("/a/b%20c?x=1&y",
+                target_form::origin);
+            BOOST_TEST(! u.has_scheme());
+            BOOST_TEST(! u.has_authority());
+            BOOST_TEST(u.encoded_path() == "/a/b%20c");
+            BOOST_TEST(u.path().size() == 2);
+            BOOST_TEST(u.encoded_query() == "x=1&y");
+            BOOST_TEST(u.query_params().size() == 2);
+        }
+        {
+            // "//" is a path here
+            auto const u = good("//x/y",
+                target_form::origin);
+            BOOST_TEST(! u.has_authority());
+            BOOST_TEST(u.encoded_path() == "//x/y");
+            BOOST_TEST(u.path().size() == 3);
+        }
+        {
+            auto const u = good("/:@?/?",
+                target_form::origin);
+            BOOST_TEST(u.encoded_path() == "/:@");
+            BOOST_TEST(u.encoded_query() == "/?");
+        }
+        bad("/#f");
+        bad("/a?b#");
+        bad("/a b");
+        bad("/%2");
+        bad("/%zz");
+    }
+
+    void
+    testAbsolute()
+    {
+        {
+            auto const u = good(
+                "http://www.example.org/pub/WWW/TheProject.html",
+                target_form::absolute);
+            BOOST_TEST(u.scheme() == "http");
+            BOOST_TEST(u.encoded_host() == "www.example.org");
+            BOOST_TEST(u.encoded_path() ==
+                "/pub/WWW/TheProject.html");
+        }
+        {
+            auto const u = good("http://h:80?q",
+                target_form::absolute);
+            BOOST_TEST(u.port_number() == 80);
+            BOOST_TEST(u.encoded_query() == "q");
+        }
+        good("mailto:x@y", target_form::absolute);
+        good("x:1a", target_form::absolute);
+        good("x:1?q", target_form::absolute);
+        good("x://1", target_form::absolute);
+        bad("http://h/#f");
+        bad("http://h/ x");
+    }
+
+    void
+    testAuthority()
+    {
+        {
+            auto const u = good("www.example.com:80",
+                target_form::authority);
+            BOOST_TEST(! u.has_scheme());
+            BOOST_TEST(u.encoded_host() == "www.example.com");
+            BOOST_TEST(u.host_type() == host_type::name);
+            BOOST_TEST(u.port() == "80");
+            BOOST_TEST(u.port_number() == 80);
+            BOOST_TEST(u.encoded_path() == "");
+            BOOST_TEST(u.has_authority());
+            BOOST_TEST(u.encoded_authority() ==
+                "www.example.com:80");
+            BOOST_TEST(! u.has_userinfo());
+            BOOST_TEST(u.encoded_userinfo() == "");
+            BOOST_TEST(u.encoded_username() == "");
+            BOOST_TEST(! u.has_password());
+        }
+        {
+            error_code ec;
+            target_form f;
+            auto const u = parse_request_target(
+                "example.com:443", f, ec);
+            BOOST_TEST(! ec);
+            BOOST_TEST(f == target_form::authority);
+            BOOST_TEST(u.has_authority());
+            BOOST_TEST(u.encoded_authority() ==
+                "example.com:443");
+            BOOST_TEST(u.encoded_host() == "example.com");
+        }
+        {
+            auto const u = good("127.0.0.1:443",
+                target_form::authority);
+            BOOST_TEST(u.host_type() == host_type::ipv4);
+            BOOST_TEST(u.ipv4_address() ==
+                ipv4_address(0x7f000001));
+            BOOST_TEST(u.port_number() == 443);
+        }
+        {
+            auto const u = good("[::1]:8080",
+                target_form::authority);
+            BOOST_TEST(u.host_type() == host_type::ipv6);
+            BOOST_TEST(u.encoded_host() == "[::1]");
+            BOOST_TEST(u.port_number() == 8080);
+        }
+        {
+            auto const u = good("h:",
+                target_form::authority);
+            BOOST_TEST(u.has_authority());
+            BOOST_TEST(u.encoded_authority() == "h:");
+        }
+        bad("[::1]");
+        bad("1.2.3.4");
+        bad("user@host:80");
+        bad("[::1]:80/");
+        bad("host:80#");
+        bad("");
+    }
+
+    void
+    testAsterisk()
+    {
+        auto const u = good("*",
+            target_form::asterisk);
+        BOOST_TEST(u.encoded_path() == "*");
+        BOOST_TEST(u.path().size() == 1);
+        BOOST_TEST(! u.has_query());
+        BOOST_TEST(! u.has_fragment());
+        BOOST_TEST(u.host_type() == host_type::none);
+        bad("**");
+        bad("*/");
+    }
+
+    void
+    run()
+    {
+        testOrigin();
+        testAbsolute();
+        testAuthority();
+        testAsterisk();
+    }
+};
+
+TEST_SUITE(
+    request_target_test,
+    "boost.url.request_target");
+
+} // urls
+} // boost
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <iostream>
+#include <type_traits>
 
 namespace boost {
 namespace urls {
@@ -26,8 +27,8 @@ public:
     using table_type = std::array<
         std::uint8_t, 256>;
 
-    // This is used to generate the
-    // initializer for the char table
+    // This is the reference for the
+    // flags computed by char_set_flags
     void
     build_table(table_type& v)
     {
@@ -86,11 +87,35 @@ public:
         dout.flush();
     }
 
+    void
+    testFlags()
+    {
+        table_type tab;
+        build_table(tab);
+        for_each_char(
+        [&tab](char c)
+        {
+            BOOST_TEST(detail::char_set_flags(c) ==
+                tab[static_cast<unsigned char>(c)]);
+        });
+
+        // evaluated at compile time
+        BOOST_STATIC_ASSERT(
+            masked_char_set<pchar_mask>{}('@'));
+        BOOST_STATIC_ASSERT(
+            ! masked_char_set<pchar_mask>{}('/'));
+        BOOST_STATIC_ASSERT(
+            std::is_empty<masked_char_set<
+                qpchar_mask>>::value);
+    }
+
     void
     run()
     {
         //print_table();
 
+        testFlags();
+
         test_char_set(masked_char_set<
             query_char_mask>(),
             // unreserved
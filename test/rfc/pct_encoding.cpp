@@ -11,6 +11,8 @@
 #include <boost/url/rfc/pct_encoding.hpp>
 
 #include "test_suite.hpp"
+#include <cstring>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -18,9 +20,240 @@ namespace urls {
 class pct_encoding_test
 {
 public:
+    static
+    std::string
+    decode(string_view s)
+    {
+        std::string r;
+        r.resize(
+            pct_decoded_size_unchecked(s));
+        pct_decode_unchecked(
+            &r[0], &r[0] + r.size(), s);
+        return r;
+    }
+
+    // plain byte-at-a-time decoder
+    static
+    std::string
+    reference(string_view s)
+    {
+        std::string r;
+        for(std::size_t i = 0; i < s.size();)
+        {
+            if(s[i] != '%')
+            {
+                r.push_back(s[i++]);
+                continue;
+            }
+            r.push_back(static_cast<char>(
+                (bnf::hexdig_value(s[i + 1]) << 4) +
+                bnf::hexdig_value(s[i + 2])));
+            i += 3;
+        }
+        return r;
+    }
+
+    void
+    check(string_view s)
+    {
+        auto const r = reference(s);
+        BOOST_TEST(
+            pct_decoded_size_unchecked(s) ==
+                r.size());
+        BOOST_TEST(decode(s) == r);
+
+        // a larger buffer keeps its tail
+        {
+            char buf[128];
+            if(r.size() + 64 > sizeof(buf))
+                return;
+            std::memset(buf, '*', sizeof(buf));
+            pct_decode_unchecked(
+                buf, buf + sizeof(buf), s);
+            BOOST_TEST(string_view(
+                buf, r.size()) == r);
+            BOOST_TEST(std::string(
+                buf + r.size(),
+                sizeof(buf) - r.size()) ==
+                std::string(
+                    sizeof(buf) - r.size(), '*'));
+        }
+    }
+
+    void
+    testDecode()
+    {
+        check("");
+        check("x");
+        check("%41");
+        check("%2f%2F%aA%Ff%00%80");
+        check("abcdefghijklmnop");
+        check("abcdefghijklmno%41");
+        check("%41bcdefghijklmnopqrstuvwxyz%5A");
+        check("a%41%41%41%41%41");
+        check("%41%41%41%41%41%41%41%41%41%41%41");
+
+        // every byte value
+        {
+            std::string s;
+            for(int i = 0; i < 256; ++i)
+            {
+                char const* const hex =
+                    "0123456789ABCDEF";
+                s.push_back('%');
+                s.push_back(hex[i >> 4]);
+                s.push_back(hex[i & 15]);
+            }
+            auto const r = decode(s);
+            BOOST_TEST(r.size() == 256);
+            for(int i = 0; i < 256; ++i)
+                BOOST_TEST(static_cast<
+                    unsigned char>(r[i]) == i);
+        }
+
+        // mixed runs at every length and
+        // alignment, so the vector paths
+        // see escapes in each position
+        // and the tails are covered
+        unsigned seed = 1;
+        auto const rand = [&seed]
+        {
+            seed = seed * 1103515245 + 12345;
+            return (seed >> 16) & 0x7fff;
+        };
+        char const* const hex =
+            "0123456789abcdefABCDEF";
+        for(int i = 0; i < 2000; ++i)
+        {
+            std::string s;
+            auto const n = rand() % 100;
+            auto const density = rand() % 8;
+            while(s.size() < n)
+            {
+                if(rand() % 8 < density)
+                {
+                    s.push_back('%');
+                    s.push_back(hex[rand() % 22]);
+                    s.push_back(hex[rand() % 22]);
+                }
+                else
+                {
+                    s.push_back(static_cast<char>(
+                        'a' + rand() % 26));
+                }
+            }
+            check(s);
+        }
+    }
+
+    // plain byte-at-a-time encoder
+    template<class CharSet>
+    static
+    std::string
+    reference_encode(
+        string_view s,
+        CharSet const& cs)
+    {
+        char const* const hex =
+            "0123456789ABCDEF";
+        std::string r;
+        for(char c : s)
+        {
+            if(cs(c))
+            {
+                r.push_back(c);
+                continue;
+            }
+            auto const u = static_cast<
+                unsigned char>(c);
+            r.push_back('%');
+            r.push_back(hex[u >> 4]);
+            r.push_back(hex[u & 0xf]);
+        }
+        return r;
+    }
+
+    template<class CharSet>
+    void
+    check_encode(
+        string_view s,
+        CharSet const& cs)
+    {
+        auto const r =
+            reference_encode(s, cs);
+        BOOST_TEST(
+            pct_encoded_size(s, cs) == r.size());
+        auto const e = pct_encode(s, cs);
+        BOOST_TEST(e == r);
+        BOOST_TEST(decode(e) == s);
+
+        // the sized form writes into
+        // a larger buffer
+        std::string buf(r.size() + 40, '*');
+        BOOST_TEST(pct_encode(&buf[0],
+            &buf[0] + buf.size(), s, cs) ==
+                r.size());
+        BOOST_TEST(buf.substr(
+            0, r.size()) == r);
+    }
+
+    void
+    testEncode()
+    {
+        masked_char_set<pchar_mask> const cs;
+        check_encode("", cs);
+        check_encode("x", cs);
+        check_encode(" ", cs);
+        check_encode("a b", cs);
+        check_encode("abcdefghijklmnop", cs);
+        check_encode("abcdefghijklmno ", cs);
+        check_encode("                                ", cs);
+        check_encode(string_view("\0\x7f\x80\xff", 4), cs);
+        BOOST_TEST(pct_encode("/a b?", cs) ==
+            "%2Fa%20b%3F");
+        BOOST_TEST(pct_encode("/a b?",
+            masked_char_set<qpchar_mask>{}) ==
+                "/a%20b?");
+
+        // every byte value
+        {
+            std::string s;
+            for(int i = 0; i < 256; ++i)
+                s.push_back(static_cast<char>(i));
+            check_encode(s, cs);
+            check_encode(s,
+                masked_char_set<unsub_char_mask>{});
+        }
+
+        unsigned seed = 1;
+        auto const rand = [&seed]
+        {
+            seed = seed * 1103515245 + 12345;
+            return (seed >> 16) & 0x7fff;
+        };
+        for(int i = 0; i < 2000; ++i)
+        {
+            std::string s;
+            auto const n = rand() % 100;
+            auto const density = rand() % 8;
+            while(s.size() < n)
+            {
+                if(rand() % 8 < density)
+                    s.push_back(static_cast<
+                        char>(rand() % 256));
+                else
+                    s.push_back(static_cast<
+                        char>('a' + rand() % 26));
+            }
+            check_encode(s, cs);
+        }
+    }
+
     void
     run()
     {
+        testDecode();
+        testEncode();
     }
 };
 
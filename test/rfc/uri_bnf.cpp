@@ -21,9 +21,53 @@ namespace urls {
 class uri_bnf_test
 {
 public:
+    // is_valid runs the same
+    // parser as bnf::parse
+    void
+    check(string_view s)
+    {
+        error_code ec;
+        uri_bnf t;
+        BOOST_TEST(
+            bnf::is_valid<uri_bnf>(s) ==
+            bnf::parse(s, ec, t));
+    }
+
+    void
+    testIsValid()
+    {
+        check("");
+        check(":");
+        check("a:/");
+        check("a+b:x");
+        check("x:?");
+        check("http:");
+        check("http://x.y.z/?a=b&c=d&#12%23");
+        check("http://##");
+        check("//x");
+    }
+
+    void
+    testIsValidUri()
+    {
+        BOOST_TEST(is_valid_uri("http:"));
+        BOOST_TEST(is_valid_uri("a:/"));
+        BOOST_TEST(is_valid_uri("a+b:x"));
+        BOOST_TEST(is_valid_uri("x:?"));
+        BOOST_TEST(is_valid_uri(
+            "http://x.y.z/?a=b&c=d&#12%23"));
+        BOOST_TEST(! is_valid_uri(""));
+        BOOST_TEST(! is_valid_uri(":"));
+        BOOST_TEST(! is_valid_uri("//x"));
+        BOOST_TEST(! is_valid_uri("http://##"));
+    }
+
     void
     run()
     {
+        testIsValid();
+        testIsValidUri();
+
         using T = uri_bnf;
 
         bad<T>("");
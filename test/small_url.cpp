@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/small_url.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class small_url_test
+{
+public:
+    template<class T>
+    static
+    bool
+    is_inline(T const& u)
+    {
+        auto const p = u.encoded_url().data();
+        auto const first =
+            reinterpret_cast<char const*>(&u);
+        return p >= first &&
+            p < first + sizeof(u);
+    }
+
+    void
+    testCtor()
+    {
+        {
+            small_url<32> u;
+            BOOST_TEST(u.empty());
+            BOOST_TEST(u.encoded_url() == "");
+            BOOST_TEST(u.capacity() == 32);
+            BOOST_TEST(is_inline(u));
+        }
+        {
+            small_url<32> u("http://example.com/a");
+            BOOST_TEST(u.encoded_url() ==
+                "http://example.com/a");
+            BOOST_TEST(u.encoded_host() == "example.com");
+            BOOST_TEST(is_inline(u));
+        }
+        {
+            small_url<32> u(storage_ptr(), "/x");
+            BOOST_TEST(u.encoded_url() == "/x");
+            BOOST_TEST(is_inline(u));
+        }
+        {
+            // does not fit
+            small_url<8> u("http://example.com/a");
+            BOOST_TEST(u.encoded_url() ==
+                "http://example.com/a");
+            BOOST_TEST(! is_inline(u));
+        }
+        BOOST_TEST_THROWS(
+            small_url<32>("http:#%"),
+            std::exception);
+    }
+
+    void
+    testCopy()
+    {
+        {
+            small_url<32> const u0("http://example.com/a");
+            small_url<32> u1(u0);
+            BOOST_TEST(u1.encoded_url() == u0.encoded_url());
+            BOOST_TEST(is_inline(u1));
+            small_url<32> u2;
+            u2 = u0;
+            BOOST_TEST(u2.encoded_url() == u0.encoded_url());
+            BOOST_TEST(is_inline(u2));
+            u2 = u2;
+            BOOST_TEST(u2.encoded_url() == u0.encoded_url());
+        }
+        {
+            url const u0("http://example.com/a");
+            small_url<32> u1(u0);
+            BOOST_TEST(u1.encoded_url() == u0.encoded_url());
+            BOOST_TEST(is_inline(u1));
+            small_url<32> u2;
+            u2 = u0;
+            BOOST_TEST(u2.encoded_url() == u0.encoded_url());
+        }
+    }
+
+    void
+    testModify()
+    {
+        small_url<32> u("http://example.com");
+        url& r = u;
+        r.set_encoded_path("/path");
+        r.set_encoded_query("k=v");
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path?k=v");
+        BOOST_TEST(u.capacity() == 32);
+        BOOST_TEST(is_inline(u));
+
+        // outgrow the buffer
+        std::string const s(40, 'x');
+        u.set_encoded_fragment(s);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path?k=v#" + s);
+        BOOST_TEST(u.capacity() > 32);
+        BOOST_TEST(! is_inline(u));
+        u.shrink_to_fit();
+        BOOST_TEST(! is_inline(u));
+        BOOST_TEST(u.capacity() == u.size());
+
+        // back to the buffer
+        u.set_encoded_fragment("");
+        u.shrink_to_fit();
+        BOOST_TEST(is_inline(u));
+        BOOST_TEST(u.capacity() == 32);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path?k=v");
+        u.shrink_to_fit();
+        BOOST_TEST(is_inline(u));
+
+        u.clear();
+        BOOST_TEST(u.encoded_url() == "");
+        u.reserve(100);
+        BOOST_TEST(! is_inline(u));
+        u.shrink_to_fit();
+        BOOST_TEST(is_inline(u));
+        BOOST_TEST(u.encoded_url() == "");
+    }
+
+    void
+    run()
+    {
+        testCtor();
+        testCopy();
+        testModify();
+    }
+};
+
+TEST_SUITE(
+    small_url_test,
+    "boost.url.small_url");
+
+} // urls
+} // boost
@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/static_url.hpp>
+
+#include "test_suite.hpp"
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class static_url_test
+{
+public:
+    void
+    testCtor()
+    {
+        {
+            static_url<32> u;
+            BOOST_TEST(u.empty());
+            BOOST_TEST(u.encoded_url() == "");
+            BOOST_TEST(u.capacity() == 32);
+        }
+        {
+            static_url<32> u("http://example.com/a");
+            BOOST_TEST(u.encoded_url() ==
+                "http://example.com/a");
+            BOOST_TEST(u.encoded_host() == "example.com");
+        }
+        BOOST_TEST_THROWS(
+            static_url<8>("http://example.com/a"),
+            too_large);
+        BOOST_TEST_THROWS(
+            static_url<32>("http:#%"),
+            std::exception);
+        {
+            static_url<32> const u0("http://example.com/a");
+            static_url<32> u1(u0);
+            BOOST_TEST(u1.encoded_url() == u0.encoded_url());
+            static_url<32> u2;
+            u2 = u0;
+            BOOST_TEST(u2.encoded_url() == u0.encoded_url());
+            u2 = u2;
+            BOOST_TEST(u2.encoded_url() == u0.encoded_url());
+
+            static_url<64> u3(u0);
+            BOOST_TEST(u3.encoded_url() == u0.encoded_url());
+            BOOST_TEST_THROWS(
+                static_url<8>{u0},
+                too_large);
+        }
+        {
+            url_view const v = parse_uri(
+                "http://example.com/a?k=v");
+            static_url<32> u(v);
+            BOOST_TEST(u.encoded_url() == v.encoded_url());
+        }
+    }
+
+    void
+    testSetEncodedUrl()
+    {
+        error_code ec;
+        static_url<20> u;
+        u.set_encoded_url("http://example.com/a", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/a");
+
+        u.set_encoded_url("http://example.com/ab", ec);
+        BOOST_TEST(ec == error::capacity_exceeded);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/a");
+
+        u.set_encoded_url("http:#%", ec);
+        BOOST_TEST(ec.failed());
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/a");
+
+        u.set_encoded_url("/x", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() == "/x");
+
+        u.set_encoded_url("", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() == "");
+
+        BOOST_TEST_THROWS(u.set_encoded_url(
+            "http://example.com/ab"), too_large);
+    }
+
+    void
+    testSetters()
+    {
+        error_code ec;
+        static_url<32> u("http://example.com");
+        u.set_encoded_path("/path", ec);
+        BOOST_TEST(! ec);
+        u.set_encoded_query("k=v", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path?k=v");
+
+        // does not fit
+        auto const check_full =
+            [&u, &ec]
+            {
+                BOOST_TEST(ec ==
+                    error::capacity_exceeded);
+                BOOST_TEST(u.encoded_url() ==
+                    "http://example.com/path?k=v");
+                BOOST_TEST(u.capacity() == 32);
+            };
+        u.set_encoded_fragment("0123456789", ec);
+        check_full();
+        u.set_fragment("0123456789", ec);
+        check_full();
+        u.set_fragment_part("#0123456789", ec);
+        check_full();
+        u.set_scheme("https-and-more", ec);
+        check_full();
+        u.set_encoded_origin("http://example.com:65535", ec);
+        check_full();
+        u.set_encoded_authority("username@example.com", ec);
+        check_full();
+        u.set_encoded_userinfo("user:pass", ec);
+        check_full();
+        u.set_userinfo_part("user:pass@", ec);
+        check_full();
+        u.set_user("username", ec);
+        check_full();
+        u.set_encoded_user("username", ec);
+        check_full();
+        u.set_password("password", ec);
+        check_full();
+        u.set_encoded_password("password", ec);
+        check_full();
+        u.set_password_part(":password", ec);
+        check_full();
+        u.set_host("www1.www.example.com", ec);
+        check_full();
+        u.set_encoded_host("www1.www.example.com", ec);
+        check_full();
+        u.set_port(65535, ec);
+        check_full();
+        u.set_port("65535", ec);
+        check_full();
+        u.set_port_part(":65535", ec);
+        check_full();
+        u.set_path("/a/longer/path", ec);
+        check_full();
+        u.set_encoded_path("/a/longer/path", ec);
+        check_full();
+        u.set_query("k=v&k2=v2", ec);
+        check_full();
+        u.set_encoded_query("k=v&k2=v2", ec);
+        check_full();
+        u.set_query_part("?k=v&k2=v2", ec);
+        check_full();
+
+        // invalid
+        u.set_encoded_query("%", ec);
+        BOOST_TEST(ec == error::invalid);
+        u.set_port("x", ec);
+        BOOST_TEST(ec == error::invalid);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path?k=v");
+
+        // shrinking always fits
+        u.set_encoded_query("", ec);
+        BOOST_TEST(! ec);
+        u.set_encoded_fragment("f", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://example.com/path#f");
+
+        // inherited setters throw
+        BOOST_TEST_THROWS(
+            u.set_encoded_fragment("0123456789ab"),
+            too_large);
+        BOOST_TEST_THROWS(
+            u.reserve(33),
+            too_large);
+        u.reserve(32);
+        u.shrink_to_fit();
+        BOOST_TEST(u.capacity() == 32);
+    }
+
+    void
+    testSegments()
+    {
+        error_code ec;
+        static_url<20> u("http://h/a/b");
+        auto ps = u.path();
+
+        // fits
+        auto it = ps.insert_encoded(
+            ps.begin(), "x", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://h/x/a/b");
+        it = ps.insert(it, "y z", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://h/x/y%20z/a/b");
+        BOOST_TEST(u.size() == 20);
+
+        // does not fit
+        auto const check_full =
+            [&u, &ec]
+            {
+                BOOST_TEST(ec ==
+                    error::capacity_exceeded);
+                BOOST_TEST(u.encoded_url() ==
+                    "http://h/x/y%20z/a/b");
+                BOOST_TEST(u.path().size() == 4);
+            };
+        ps.insert_encoded(ps.begin(), "c", ec);
+        check_full();
+        ps.insert(ps.begin(), "c", ec);
+        check_full();
+        ps.replace_encoded(ps.begin(), "xx", ec);
+        check_full();
+        ps.replace(ps.begin(), "x x", ec);
+        check_full();
+
+        // invalid
+        ps.insert_encoded(ps.begin(), "%", ec);
+        BOOST_TEST(ec == error::invalid);
+        ps.replace_encoded(ps.begin(), "/", ec);
+        BOOST_TEST(ec == error::invalid);
+        BOOST_TEST(u.encoded_url() ==
+            "http://h/x/y%20z/a/b");
+
+        // same size
+        ps.replace_encoded(ps.begin(), "w", ec);
+        BOOST_TEST(! ec);
+        ps.replace(ps.begin(), "v", ec);
+        BOOST_TEST(! ec);
+        BOOST_TEST(u.encoded_url() ==
+            "http://h/v/y%20z/a/b");
+
+        // erase never fails
+        ps.erase(ps.begin());
+        BOOST_TEST(u.encoded_url() ==
+            "http://h/y%20z/a/b");
+
+        BOOST_TEST_THROWS(
+            ps.insert(ps.begin(), "0123"),
+            too_large);
+    }
+
+    void
+    testView()
+    {
+        static_url<64> u("http://user@example.com/a%20b");
+        u.set_encoded_query("k=%41");
+        u.set_user("us%er");
+        url_view const v = u;
+        BOOST_TEST(v.encoded_url() == u.encoded_url());
+        BOOST_TEST(v.encoded_url().data() ==
+            u.encoded_url().data());
+        BOOST_TEST(v.decoded_username() == "us%er");
+        BOOST_TEST(v.encoded_host() == "example.com");
+        BOOST_TEST(v.encoded_query() == "k=%41");
+        BOOST_TEST(v.decoded_query() == "k=A");
+        BOOST_TEST(v.path().size() == 1);
+        BOOST_TEST(v.query_params().size() == 1);
+
+        url_view const v0 = url();
+        BOOST_TEST(v0.encoded_url() == "");
+    }
+
+    void
+    run()
+    {
+        testCtor();
+        testSetEncodedUrl();
+        testSetters();
+        testSegments();
+        testView();
+    }
+};
+
+TEST_SUITE(
+    static_url_test,
+    "boost.url.static_url");
+
+} // urls
+} // boost
@@ -655,6 +655,92 @@ public:
         BOOST_TEST(sp->encoded_url() == s);
     }
 
+    void
+    testBatch()
+    {
+        string_view const v[] = {
+            "http://www.example.com/x?y#z",
+            "/path/only",
+            "x:",
+            "%" };
+        {
+            url_view u[4];
+            error_code ec[4];
+            BOOST_TEST(parse_uri_batch(
+                v, 4, u, ec) == 2);
+            BOOST_TEST(! ec[0]);
+            BOOST_TEST(ec[1]);
+            BOOST_TEST(! ec[2]);
+            BOOST_TEST(ec[3]);
+            BOOST_TEST(u[0].encoded_host() ==
+                "www.example.com");
+            BOOST_TEST(u[0].encoded_path() == "/x");
+            BOOST_TEST(u[0].encoded_query() == "y");
+            BOOST_TEST(u[0].encoded_fragment() == "z");
+            BOOST_TEST(u[1].empty());
+            BOOST_TEST(u[2].scheme() == "x");
+            BOOST_TEST(u[3].empty());
+            for(int i = 0; i < 4; ++i)
+            {
+                error_code ec1;
+                auto const u1 = parse_uri(v[i], ec1);
+                BOOST_TEST(ec1 == ec[i]);
+                BOOST_TEST(u1.encoded_url() ==
+                    u[i].encoded_url());
+            }
+        }
+        {
+            url_view u[4];
+            BOOST_TEST(parse_relative_ref_batch(
+                v, 4, u) == 3);
+            BOOST_TEST(u[1].encoded_path() ==
+                "/path/only");
+            BOOST_TEST(u[1].path().size() == 2);
+        }
+        BOOST_TEST(parse_uri_batch(
+            v, 0, nullptr) == 0);
+    }
+
+    //--------------------------------------------
+
+    // decoded accessors use the sizes
+    // recorded by the parser
+    void
+    testDecoded()
+    {
+        auto const u = parse_uri(
+            "x://%41b:c%3Ad@h%2Eh/p%20/%2F?k%3D=v%26&%25#f%23");
+        BOOST_TEST(u.username() == "Ab");
+        BOOST_TEST(u.password() == "c:d");
+        BOOST_TEST(u.userinfo() == "Ab:c:d");
+        BOOST_TEST(u.host() == "h.h");
+        BOOST_TEST(u.query() == "k==v&&%");
+        BOOST_TEST(u.fragment() == "f#");
+        {
+            auto it = u.path().begin();
+            BOOST_TEST(it->segment() == "p ");
+            ++it;
+            BOOST_TEST(it->segment() == "/");
+        }
+        {
+            auto it = u.query_params().begin();
+            BOOST_TEST(it->key() == "k=");
+            BOOST_TEST(it->value() == "v&");
+            ++it;
+            BOOST_TEST(it->key() == "%");
+            BOOST_TEST(it->value() == "");
+        }
+        {
+            auto const v = parse_relative_ref(
+                "//%75:@h?#");
+            BOOST_TEST(v.username() == "u");
+            BOOST_TEST(v.password() == "");
+            BOOST_TEST(v.userinfo() == "u:");
+            BOOST_TEST(v.query() == "");
+            BOOST_TEST(v.fragment() == "");
+        }
+    }
+
     //--------------------------------------------
 
     void
@@ -681,6 +767,8 @@ public:
         testHostAndPort();
         testQuery();
         testFragment();
+        testBatch();
+        testDecoded();
         testOutput();
     }
 };